@@ -9,10 +9,12 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/preemption.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device_info.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
 
 #include "level_zero/core/source/device/device_imp.h"
 
@@ -116,13 +118,7 @@ void CommandList::eraseDeallocationContainerEntry(NEO::GraphicsAllocation *alloc
 }
 
 void CommandList::eraseResidencyContainerEntry(NEO::GraphicsAllocation *allocation) {
-    std::vector<NEO::GraphicsAllocation *>::iterator allocErase;
-    auto container = &commandContainer.getResidencyContainer();
-
-    allocErase = std::find(container->begin(), container->end(), allocation);
-    if (allocErase != container->end()) {
-        container->erase(allocErase);
-    }
+    commandContainer.removeFromResidencyContainer(allocation);
 }
 
 bool CommandList::isCopyOnly() const {
@@ -137,6 +133,19 @@ NEO::PreemptionMode CommandList::obtainFunctionPreemptionMode(Kernel *kernel) {
 }
 
 void CommandList::makeResidentAndMigrate(bool performMigration) {
+    if (frozen) {
+        for (auto alloc : commandContainer.getResidencyContainer()) {
+            csr->makeResident(*alloc);
+        }
+        if (performMigration && !migratableAllocations.empty()) {
+            auto pageFaultManager = device->getDriverHandle()->getMemoryManager()->getPageFaultManager();
+            for (auto alloc : migratableAllocations) {
+                pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(alloc->getGpuAddress()));
+            }
+        }
+        return;
+    }
+
     for (auto alloc : commandContainer.getResidencyContainer()) {
         if (csr->getResidencyAllocations().end() ==
             std::find(csr->getResidencyAllocations().begin(), csr->getResidencyAllocations().end(), alloc)) {
@@ -152,6 +161,36 @@ void CommandList::makeResidentAndMigrate(bool performMigration) {
     }
 }
 
+void CommandList::freeze() {
+    migratableAllocations.clear();
+    for (auto alloc : commandContainer.getResidencyContainer()) {
+        if (alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_GPU ||
+            alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_CPU) {
+            migratableAllocations.push_back(alloc);
+        }
+    }
+    frozen = true;
+}
+
+bool CommandList::isSharedAllocationsMigrationRequired() const {
+    if (NEO::DebugManager.flags.EnableKernelScopedUsmMigration.get() == 1) {
+        // allocations referenced directly are migrated with the residency container,
+        // remaining ones can be reached only by kernels with indirect shared access
+        // or kernels loading pointers which are not kernel arguments
+        return this->unifiedMemoryControls.indirectSharedAllocationsAllowed || this->containsKernelsWithIndirectAccess;
+    }
+    return true;
+}
+
+void CommandList::addPrefetchedAllocationForMigration(NEO::SvmAllocationData *allocData) {
+    if (NEO::DebugManager.flags.EnableUsmPrefetchMigration.get() != 1 ||
+        allocData->memoryType != InternalMemoryType::SHARED_UNIFIED_MEMORY) {
+        return;
+    }
+    // shared allocations in the residency container are moved to the GPU domain on submission
+    commandContainer.addToResidencyContainer(allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex()));
+}
+
 void CommandList::migrateSharedAllocations() {
     auto deviceImp = static_cast<DeviceImp *>(device);
     DriverHandleImp *driverHandleImp = static_cast<DriverHandleImp *>(deviceImp->getDriverHandle());
@@ -22,6 +22,10 @@
 
 struct _ze_command_list_handle_t {};
 
+namespace NEO {
+struct SvmAllocationData;
+}
+
 namespace L0 {
 struct EventPool;
 struct Event;
@@ -95,7 +99,7 @@ struct CommandList : _ze_command_list_handle_t {
     virtual ze_result_t appendMemoryCopy(void *dstptr, const void *srcptr, size_t size,
                                          ze_event_handle_t hSignalEvent, uint32_t numWaitEvents,
                                          ze_event_handle_t *phWaitEvents) = 0;
-    virtual ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstptr, NEO::GraphicsAllocation *srcptr, size_t size, bool flushHost) = 0;
+    virtual ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstptr, NEO::GraphicsAllocation *srcptr, size_t offset, size_t size, bool flushHost) = 0;
     virtual ze_result_t appendMemoryCopyRegion(void *dstPtr,
                                                const ze_copy_region_t *dstRegion,
                                                uint32_t dstPitch,
@@ -244,7 +248,13 @@ struct CommandList : _ze_command_list_handle_t {
     }
 
     void makeResidentAndMigrate(bool);
+    void freeze();
+    bool isFrozen() const {
+        return frozen;
+    }
     void migrateSharedAllocations();
+    bool isSharedAllocationsMigrationRequired() const;
+    void addPrefetchedAllocationForMigration(NEO::SvmAllocationData *allocData);
 
     std::vector<Kernel *> printfFunctionContainer;
     CommandQueue *cmdQImmediate = nullptr;
@@ -272,15 +282,19 @@ struct CommandList : _ze_command_list_handle_t {
     NEO::StreamProperties requiredStreamState{};
     NEO::StreamProperties finalStreamState{};
     CommandsToPatch commandsToPatch{};
+    // shared allocations from residency container, collected once when command list is frozen on close
+    std::vector<NEO::GraphicsAllocation *> migratableAllocations;
 
     ze_command_list_flags_t flags = 0u;
     UnifiedMemoryControls unifiedMemoryControls;
 
     NEO::EngineGroupType engineGroupType;
     bool indirectAllocationsAllowed = false;
+    bool containsKernelsWithIndirectAccess = false;
     bool internalUsage = false;
     bool containsCooperativeKernelsFlag = false;
     bool containsStatelessUncachedResource = false;
+    bool frozen = false;
 };
 
 using CommandListAllocatorFn = CommandList *(*)(uint32_t);
@@ -92,12 +92,15 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
     unifiedMemoryControls.indirectHostAllocationsAllowed = false;
     unifiedMemoryControls.indirectSharedAllocationsAllowed = false;
     unifiedMemoryControls.indirectDeviceAllocationsAllowed = false;
+    containsKernelsWithIndirectAccess = false;
     commandListPreemptionMode = device->getDevicePreemptionMode();
     commandListPerThreadScratchSize = 0u;
     requiredStreamState = {};
     finalStreamState = requiredStreamState;
     containsAnyKernel = false;
     containsCooperativeKernelsFlag = false;
+    frozen = false;
+    migratableAllocations.clear();
     clearCommandsToPatch();
     commandListSLMEnabled = false;
 
@@ -176,6 +179,10 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::close() {
     commandContainer.removeDuplicatesFromResidencyContainer();
     NEO::EncodeBatchBufferStartOrEnd<GfxFamily>::programBatchBufferEnd(commandContainer);
 
+    if (NEO::DebugManager.flags.FreezeCommandListsOnClose.get()) {
+        freeze();
+    }
+
     return ZE_RESULT_SUCCESS;
 }
 
@@ -996,7 +1003,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendCopyImageBlit(NEO::Graph
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstAllocation,
                                                                       NEO::GraphicsAllocation *srcAllocation,
-                                                                      size_t size, bool flushHost) {
+                                                                      size_t offset, size_t size, bool flushHost) {
 
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
 
@@ -1004,7 +1011,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::Graph
     uintptr_t rightSize = size % middleElSize;
     bool isStateless = false;
 
-    if (size >= 4ull * MemoryConstants::gigaByte) {
+    if (offset + size >= 4ull * MemoryConstants::gigaByte) {
         isStateless = true;
     }
 
@@ -1012,14 +1019,14 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::Graph
     uintptr_t srcAddress = static_cast<uintptr_t>(srcAllocation->getGpuAddress());
     ze_result_t ret = ZE_RESULT_ERROR_UNKNOWN;
     if (isCopyOnly()) {
-        return appendMemoryCopyBlit(dstAddress, dstAllocation, 0u,
-                                    srcAddress, srcAllocation, 0u,
+        return appendMemoryCopyBlit(dstAddress, dstAllocation, offset,
+                                    srcAddress, srcAllocation, offset,
                                     size);
     } else {
         ret = appendMemoryCopyKernelWithGA(reinterpret_cast<void *>(&dstAddress),
-                                           dstAllocation, 0,
+                                           dstAllocation, offset,
                                            reinterpret_cast<void *>(&srcAddress),
-                                           srcAllocation, 0,
+                                           srcAllocation, offset,
                                            size - rightSize,
                                            middleElSize,
                                            Builtin::CopyBufferToBufferMiddle,
@@ -1027,9 +1034,9 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::Graph
                                            isStateless);
         if (ret == ZE_RESULT_SUCCESS && rightSize) {
             ret = appendMemoryCopyKernelWithGA(reinterpret_cast<void *>(&dstAddress),
-                                               dstAllocation, size - rightSize,
+                                               dstAllocation, offset + size - rightSize,
                                                reinterpret_cast<void *>(&srcAddress),
-                                               srcAllocation, size - rightSize,
+                                               srcAllocation, offset + size - rightSize,
                                                rightSize, 1UL,
                                                Builtin::CopyBufferToBufferSide,
                                                nullptr,
@@ -1399,6 +1406,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryPrefetch(const voi
                                                                        size_t count) {
     auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
     if (allocData) {
+        addPrefetchedAllocationForMigration(allocData);
         return ZE_RESULT_SUCCESS;
     }
     return ZE_RESULT_ERROR_INVALID_ARGUMENT;
@@ -89,6 +89,9 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(z
 
         this->indirectAllocationsAllowed = true;
     }
+    if (kernel->hasIndirectAccess()) {
+        this->containsKernelsWithIndirectAccess = true;
+    }
 
     bool isMixingRegularAndCooperativeKernelsAllowed = NEO::DebugManager.flags.AllowMixingRegularAndCooperativeKernels.get();
     if ((!containsAnyKernel) || isMixingRegularAndCooperativeKernelsAllowed) {
@@ -77,7 +77,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeCommandListImm
 
     this->makeResidentAndMigrate(performMigration);
 
-    if (performMigration) {
+    if (performMigration && this->isSharedAllocationsMigrationRequired()) {
         this->migrateSharedAllocations();
     }
 
@@ -99,7 +99,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeCommandListImm
 
     cmdListBBEndOffset = commandStream->getUsed();
 
-    this->commandContainer.getResidencyContainer().clear();
+    this->commandContainer.clearResidencyContainer();
 
     return ZE_RESULT_SUCCESS;
 }
@@ -330,13 +330,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendEventReset(ze_e
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstAllocation,
                                                                                NEO::GraphicsAllocation *srcAllocation,
-                                                                               size_t size, bool flushHost) {
+                                                                               size_t offset, size_t size, bool flushHost) {
 
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace();
     }
 
-    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(dstAllocation, srcAllocation, size, flushHost);
+    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(dstAllocation, srcAllocation, offset, size, flushHost);
     if (ret == ZE_RESULT_SUCCESS) {
         if (this->isFlushTaskSubmissionEnabled) {
             executeCommandListImmediateWithFlushTask(false);
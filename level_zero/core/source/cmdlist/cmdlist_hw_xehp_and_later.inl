@@ -188,6 +188,9 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(z
 
         this->indirectAllocationsAllowed = true;
     }
+    if (kernel->hasIndirectAccess()) {
+        this->containsKernelsWithIndirectAccess = true;
+    }
 
     if (NEO::DebugManager.flags.EnableSWTags.get()) {
         neoDevice->getRootDeviceEnvironment().tagsManager->insertTag<GfxFamily, NEO::SWTags::KernelNameTag>(
@@ -135,6 +135,7 @@ void CommandQueueImp::printFunctionsPrintfOutput() {
 
 void CommandQueueImp::postSyncOperations() {
     printFunctionsPrintfOutput();
+    csr->releaseIdleScratchSpace();
 
     if (NEO::Debugger::isDebugEnabled(internalUsage) && device->getL0Debugger() && NEO::DebugManager.flags.DebuggerLogBitmask.get()) {
         device->getL0Debugger()->printTrackedAddresses(csr->getOsContext().getContextId());
@@ -27,6 +27,7 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 #include "shared/source/unified_memory/unified_memory.h"
 #include "shared/source/utilities/software_tags_manager.h"
+#include "shared/source/utilities/trace_recorder.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/source/cmdlist/cmdlist_hw.h"
@@ -76,6 +77,8 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     using MI_LOAD_REGISTER_MEM = typename GfxFamily::MI_LOAD_REGISTER_MEM;
     using MI_LOAD_REGISTER_IMM = typename GfxFamily::MI_LOAD_REGISTER_IMM;
 
+    NEO::TraceScope traceScope("submission", "executeCommandLists");
+
     auto lockCSR = csr->obtainUniqueOwnership();
 
     auto anyCommandListWithCooperativeKernels = false;
@@ -232,6 +235,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     csr->getResidencyAllocations().reserve(spaceForResidency);
 
     auto scratchSpaceController = csr->getScratchSpaceController();
+    size_t skippedStateCmdsSize = 0;
     bool gsbaStateDirty = false;
     bool frontEndStateDirty = false;
     handleScratchSpace(heapContainer,
@@ -308,6 +312,8 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     if (!isCopyOnlyCommandQueue) {
         if (!gpgpuEnabled) {
             programPipelineSelect(child);
+        } else {
+            skippedStateCmdsSize += estimatePipelineSelect();
         }
 
         if (NEO::Debugger::isDebugEnabled(internalUsage) && !commandQueueDebugCmdsProgrammed && neoDevice->getSourceLevelDebugger()) {
@@ -318,6 +324,8 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
         if (gsbaStateDirty) {
             auto indirectHeap = CommandList::fromHandle(phCommandLists[0])->commandContainer.getIndirectHeap(NEO::HeapType::INDIRECT_OBJECT);
             programStateBaseAddress(scratchSpaceController->calculateNewGSH(), indirectHeap->getGraphicsAllocation()->isAllocatedInLocalMemoryPool(), child, cachedMOCSAllowed);
+        } else {
+            skippedStateCmdsSize += estimateStateBaseAddressCmdSize();
         }
 
         if (initialPreemptionMode) {
@@ -361,7 +369,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
 
     for (auto i = 0u; i < numCommandLists; ++i) {
         auto commandList = CommandList::fromHandle(phCommandLists[i]);
-        auto cmdBufferAllocations = commandList->commandContainer.getCmdBufferAllocations();
+        auto &cmdBufferAllocations = commandList->commandContainer.getCmdBufferAllocations();
         auto cmdBufferCount = cmdBufferAllocations.size();
 
         auto commandListPreemption = commandList->getCommandListPreemptionMode();
@@ -382,6 +390,8 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
                                                                statePreemption,
                                                                csr->getPreemptionAllocation());
             statePreemption = commandListPreemption;
+        } else {
+            skippedStateCmdsSize += sizeof(MI_LOAD_REGISTER_IMM);
         }
 
         if (!isCopyOnlyCommandQueue) {
@@ -395,6 +405,8 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
             if (programVfe) {
                 programFrontEnd(scratchSpaceController->getScratchPatchAddress(), scratchSpaceController->getPerThreadScratchSpaceSize(), child);
                 frontEndStateDirty = false;
+            } else {
+                skippedStateCmdsSize += estimateFrontEndCmdSize();
             }
 
             if (isPatchingVfeStateAllowed) {
@@ -416,8 +428,13 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     }
 
     if (performMigration) {
-        auto commandList = CommandList::fromHandle(phCommandLists[0]);
-        commandList->migrateSharedAllocations();
+        for (auto i = 0u; i < numCommandLists; i++) {
+            auto commandList = CommandList::fromHandle(phCommandLists[i]);
+            if (commandList->isSharedAllocationsMigrationRequired()) {
+                commandList->migrateSharedAllocations();
+                break;
+            }
+        }
     }
 
     if (stateSipRequired) {
@@ -466,6 +483,10 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
         memset(paddingPtr, 0, padding);
     }
 
+    if (NEO::DebugManager.flags.PrintSkippedStateCommandsSize.get()) {
+        printf("Submission skipped %zu bytes of state commands, programmed %zu bytes\n", skippedStateCmdsSize, child.getUsed());
+    }
+
     auto ret = submitBatchBuffer(ptrDiff(child.getCpuBase(), commandStream->getCpuBase()), csr->getResidencyAllocations(), endingCmd,
                                  anyCommandListWithCooperativeKernels);
 
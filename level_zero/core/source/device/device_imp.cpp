@@ -1032,7 +1032,7 @@ NEO::GraphicsAllocation *DeviceImp::allocateMemoryFromHostPtr(const void *buffer
 }
 
 NEO::GraphicsAllocation *DeviceImp::obtainReusableAllocation(size_t requiredSize, NEO::GraphicsAllocation::AllocationType type) {
-    auto alloc = allocationsForReuse->detachAllocation(requiredSize, nullptr, nullptr, type);
+    auto alloc = allocationsForReuse->detachCompletedAllocation(requiredSize, std::numeric_limits<size_t>::max(), *neoDevice->getMemoryManager(), type);
     if (alloc == nullptr)
         return nullptr;
     else
@@ -15,6 +15,7 @@
 #include "level_zero/core/source/driver/driver_handle.h"
 #include <level_zero/ze_api.h>
 
+#include <atomic>
 #include <limits>
 
 struct _ze_event_handle_t {};
@@ -94,6 +95,8 @@ struct Event : _ze_event_handle_t {
 
     // Metric streamer instance associated with the event.
     MetricStreamer *metricStreamer = nullptr;
+    // Set by zeEventHostSignal, so the metric notification state does not override it.
+    std::atomic<bool> signaledByHost{false};
     NEO::CommandStreamReceiver *csr = nullptr;
     void *hostAddress = nullptr;
     bool l3FlushWaApplied = false;
@@ -127,7 +127,7 @@ template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::queryStatus() {
     TagSizeT *hostAddr = static_cast<TagSizeT *>(hostAddress);
 
-    if (metricStreamer != nullptr) {
+    if (metricStreamer != nullptr && !signaledByHost) {
         *hostAddr = metricStreamer->getNotificationState();
     }
     this->csr->downloadAllocations();
@@ -190,6 +190,7 @@ ze_result_t EventImp<TagSizeT>::hostEventSetValue(TagSizeT eventVal) {
 
 template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::hostSignal() {
+    signaledByHost = true;
     return hostEventSetValue(Event::STATE_SIGNALED);
 }
 
@@ -208,6 +209,30 @@ ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
         return queryStatus();
     }
 
+    if (metricStreamer != nullptr) {
+        // Block on the oa stream in bounded slices, so a host signal from another thread also ends the wait.
+        const bool waitInfinitely = (timeout == std::numeric_limits<uint32_t>::max()) ||
+                                    (timeout == std::numeric_limits<uint64_t>::max());
+        time1 = std::chrono::high_resolution_clock::now();
+        while (true) {
+            if (signaledByHost) {
+                return ZE_RESULT_SUCCESS;
+            }
+            uint64_t waitTimeout = MetricStreamer::maxNotificationWaitNs;
+            if (!waitInfinitely) {
+                time2 = std::chrono::high_resolution_clock::now();
+                timeDiff = std::chrono::duration_cast<std::chrono::nanoseconds>(time2 - time1).count();
+                if (timeDiff >= timeout) {
+                    return ZE_RESULT_NOT_READY;
+                }
+                waitTimeout = std::min(timeout - timeDiff, waitTimeout);
+            }
+            if (metricStreamer->waitForNotification(waitTimeout) == ZE_RESULT_SUCCESS) {
+                return queryStatus();
+            }
+        }
+    }
+
     time1 = std::chrono::high_resolution_clock::now();
     while (true) {
         ret = queryStatus();
@@ -234,6 +259,7 @@ ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
 
 template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::reset() {
+    signaledByHost = false;
     if (isEventTimestampFlagSet()) {
         kernelCount = EventPacketsCount::maxKernelSplit;
         for (uint32_t i = 0; i < kernelCount; i++) {
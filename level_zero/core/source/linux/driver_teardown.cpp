@@ -5,6 +5,9 @@
  *
  */
 
+#include "shared/source/utilities/binary_log_writer.h"
+#include "shared/source/utilities/trace_recorder.h"
+
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 
 using namespace L0;
@@ -14,4 +17,6 @@ void __attribute__((destructor)) driverHandleDestructor() {
         delete GlobalDriver;
         GlobalDriver = nullptr;
     }
+    NEO::BinaryLogWriter::shutdownAll();
+    NEO::TraceRecorder::shutdownGlobal();
 }
\ No newline at end of file
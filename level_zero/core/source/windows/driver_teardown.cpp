@@ -5,6 +5,9 @@
  *
  */
 
+#include "shared/source/utilities/binary_log_writer.h"
+#include "shared/source/utilities/trace_recorder.h"
+
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 
 #include <windows.h>
@@ -17,6 +20,8 @@ BOOL APIENTRY DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved) {
             delete GlobalDriver;
             GlobalDriver = nullptr;
         }
+        NEO::BinaryLogWriter::shutdownAll();
+        NEO::TraceRecorder::shutdownGlobal();
     }
     return TRUE;
 }
@@ -26,6 +26,8 @@ ze_result_t CommandListCoreFamily<IGFX_XE_HPC_CORE>::appendMemoryPrefetch(const
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
+    addPrefetchedAllocationForMigration(allocData);
+
     if (NEO::DebugManager.flags.AddStatePrefetchCmdToMemoryPrefetchAPI.get() != 1) {
         return ZE_RESULT_SUCCESS;
     }
@@ -7,6 +7,7 @@
 
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_memory_manager.h"
 #include "shared/test/common/test_macros/test.h"
 #include "shared/test/unit_test/page_fault_manager/mock_cpu_page_fault_manager.h"
@@ -739,6 +740,42 @@ TEST_F(CommandListCreate, givenValidPtrThenAppendMemoryPrefetchReturnsSuccess) {
     ASSERT_EQ(res, ZE_RESULT_SUCCESS);
 }
 
+TEST_F(CommandListCreate, givenPrefetchMigrationEnabledWhenAppendMemoryPrefetchForSharedAllocationThenItIsAddedForMigrationOnSubmission) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableUsmPrefetchMigration.set(1);
+
+    size_t size = 10;
+    size_t alignment = 1u;
+    void *sharedPtr = nullptr;
+    void *devicePtr = nullptr;
+
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    auto res = context->allocSharedMem(device->toHandle(), &deviceDesc, &hostDesc, size, alignment, &sharedPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    res = context->allocDeviceMem(device->toHandle(), &deviceDesc, size, alignment, &devicePtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue));
+    ASSERT_NE(nullptr, commandList);
+    auto &residencyContainer = commandList->commandContainer.getResidencyContainer();
+    auto residencySizeBefore = residencyContainer.size();
+
+    res = commandList->appendMemoryPrefetch(devicePtr, size);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(residencySizeBefore, residencyContainer.size());
+
+    res = commandList->appendMemoryPrefetch(sharedPtr, size);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    ASSERT_EQ(residencySizeBefore + 1, residencyContainer.size());
+    auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(sharedPtr);
+    EXPECT_EQ(allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex()), residencyContainer.back());
+
+    context->freeMem(sharedPtr);
+    context->freeMem(devicePtr);
+}
+
 TEST_F(CommandListCreate, givenImmediateCommandListThenInternalEngineIsUsedIfRequested) {
     const ze_command_queue_desc_t desc = {};
     bool internalEngine = true;
@@ -10,6 +10,7 @@
 #include "shared/source/helpers/register_offsets.h"
 #include "shared/source/os_interface/hw_info_config.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
 #include "shared/test/common/test_macros/test.h"
 
@@ -57,6 +58,29 @@ HWTEST_F(CommandListAppendLaunchKernel, givenKernelWithIndirectAllocationsNotAll
     ASSERT_FALSE(commandList->hasIndirectAllocationsAllowed());
 }
 
+HWTEST_F(CommandListAppendLaunchKernel, givenKernelScopedMigrationWhenKernelWithIndirectAccessIsAppendedThenSharedAllocationsMigrationIsRequiredUntilReset) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableKernelScopedUsmMigration.set(1);
+
+    createKernel();
+    kernel->unifiedMemoryControls.indirectSharedAllocationsAllowed = false;
+
+    ze_group_count_t groupCount{1, 1, 1};
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue));
+
+    kernel->kernelHasIndirectAccess = false;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr));
+    EXPECT_FALSE(commandList->isSharedAllocationsMigrationRequired());
+
+    kernel->kernelHasIndirectAccess = true;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr));
+    EXPECT_TRUE(commandList->isSharedAllocationsMigrationRequired());
+
+    commandList->reset();
+    EXPECT_FALSE(commandList->isSharedAllocationsMigrationRequired());
+}
+
 HWTEST_F(CommandListAppendLaunchKernel, givenKernelWithThreadArbitrationPolicySetUsingSchedulingHintExtensionTheSameFlagIsUsedToSetCmdListThreadArbitrationPolicy) {
     createKernel();
     ze_scheduling_hint_exp_desc_t *pHint = new ze_scheduling_hint_exp_desc_t;
@@ -10,6 +10,7 @@
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/utilities/software_tags_manager.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
 #include "shared/test/common/mocks/ult_device_factory.h"
 #include "shared/test/common/test_macros/test.h"
@@ -265,6 +266,92 @@ HWTEST_F(CommandQueueExecuteCommandLists, whenExecutingCommandListsThenEndingPip
     commandQueue->destroy();
 }
 
+HWTEST_F(CommandQueueExecuteCommandLists, givenPrintSkippedStateCommandsSizeWhenExecutingCommandListsTwiceThenSkippedStateCommandsSizeIsPrintedForEachSubmission) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.PrintSkippedStateCommandsSize.set(true);
+
+    const ze_command_queue_desc_t desc{};
+    ze_result_t returnValue;
+    auto commandQueue = whitebox_cast(CommandQueue::create(productFamily,
+                                                           device,
+                                                           neoDevice->getDefaultEngine().commandStreamReceiver,
+                                                           &desc,
+                                                           false,
+                                                           false,
+                                                           returnValue));
+    ASSERT_NE(nullptr, commandQueue->commandStream);
+
+    testing::internal::CaptureStdout();
+    auto result = commandQueue->executeCommandLists(numCommandLists, commandLists, nullptr, true);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    result = commandQueue->executeCommandLists(numCommandLists, commandLists, nullptr, true);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    std::string output = testing::internal::GetCapturedStdout();
+
+    size_t submissions = 0;
+    for (auto pos = output.find("Submission skipped "); pos != std::string::npos; pos = output.find("Submission skipped ", pos + 1)) {
+        submissions++;
+    }
+    EXPECT_EQ(2u, submissions);
+
+    commandQueue->destroy();
+}
+
+HWTEST_F(CommandQueueExecuteCommandLists, givenFreezeCommandListsOnCloseWhenCommandListIsClosedThenItIsFrozenUntilReset) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.FreezeCommandListsOnClose.set(true);
+
+    auto commandList = CommandList::fromHandle(commandLists[0]);
+    EXPECT_FALSE(commandList->isFrozen());
+
+    commandList->close();
+    EXPECT_TRUE(commandList->isFrozen());
+
+    commandList->reset();
+    EXPECT_FALSE(commandList->isFrozen());
+}
+
+HWTEST_F(CommandQueueExecuteCommandLists, givenFrozenCommandListsWhenExecutingThemRepeatedlyThenResidencyContainerIsMadeResidentOnEverySubmission) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.FreezeCommandListsOnClose.set(true);
+
+    auto &csr = neoDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.storeMakeResidentAllocations = true;
+
+    for (auto i = 0u; i < numCommandLists; i++) {
+        auto commandList = CommandList::fromHandle(commandLists[i]);
+        commandList->close();
+        ASSERT_TRUE(commandList->isFrozen());
+    }
+
+    const ze_command_queue_desc_t desc{};
+    ze_result_t returnValue;
+    auto commandQueue = whitebox_cast(CommandQueue::create(productFamily,
+                                                           device,
+                                                           &csr,
+                                                           &desc,
+                                                           false,
+                                                           false,
+                                                           returnValue));
+    ASSERT_NE(nullptr, commandQueue->commandStream);
+
+    for (auto execution = 0u; execution < 2u; execution++) {
+        csr.makeResidentAllocations.clear();
+
+        auto result = commandQueue->executeCommandLists(numCommandLists, commandLists, nullptr, true);
+        ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+        for (auto i = 0u; i < numCommandLists; i++) {
+            auto commandList = CommandList::fromHandle(commandLists[i]);
+            for (auto alloc : commandList->commandContainer.getResidencyContainer()) {
+                EXPECT_TRUE(csr.isMadeResident(alloc));
+            }
+        }
+    }
+
+    commandQueue->destroy();
+}
+
 using CommandQueueExecuteSupport = IsWithinProducts<IGFX_SKYLAKE, IGFX_TIGERLAKE_LP>;
 HWTEST2_F(CommandQueueExecuteCommandLists, givenCommandQueueHaving2CommandListsThenMVSIsProgrammedWithMaxPTSS, CommandQueueExecuteSupport) {
     using MEDIA_VFE_STATE = typename FamilyType::MEDIA_VFE_STATE;
@@ -18,6 +18,7 @@
 #include "level_zero/core/source/image/image.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
 #include "level_zero/core/test/unit_tests/fixtures/host_pointer_manager_fixture.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_driver_handle.h"
 
 #include "gtest/gtest.h"
@@ -606,6 +607,54 @@ HWTEST_F(ContextMakeMemoryResidentAndMigrationTests,
     context->freeMem(ptr);
 }
 
+HWTEST2_F(ContextMakeMemoryResidentAndMigrationTests,
+          givenKernelScopedMigrationWhenExecutingCommandListsThenMemoryFromMakeResidentIsMovedToGpuOnlyForCommandListWithIndirectAccessKernels, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableKernelScopedUsmMigration.set(1);
+
+    EXPECT_CALL(*mockMemoryInterface, makeResident)
+        .WillRepeatedly(testing::Return(NEO::MemoryOperationsStatus::SUCCESS));
+    ze_result_t res = context->makeMemoryResident(device, ptr, size);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+
+    const ze_command_queue_desc_t desc = {};
+    MockCsrHw2<FamilyType> csr(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    csr.initializeTagAllocation();
+    csr.setupContext(*neoDevice->getDefaultEngine().osContext);
+
+    ze_result_t returnValue;
+    L0::CommandQueue *commandQueue = CommandQueue::create(productFamily,
+                                                          device,
+                                                          &csr,
+                                                          &desc,
+                                                          true,
+                                                          false,
+                                                          returnValue);
+    EXPECT_NE(nullptr, commandQueue);
+
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+    auto commandListHandle = commandList->toHandle();
+
+    res = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, true);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(0u, mockPageFaultManager->moveAllocationToGpuDomainCalledTimes);
+
+    commandList->containsKernelsWithIndirectAccess = true;
+    res = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, true);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(1u, mockPageFaultManager->moveAllocationToGpuDomainCalledTimes);
+    EXPECT_EQ(ptr, mockPageFaultManager->migratedAddress);
+
+    EXPECT_CALL(*mockMemoryInterface, evict)
+        .WillRepeatedly(testing::Return(NEO::MemoryOperationsStatus::SUCCESS));
+    res = context->evictMemory(device, ptr, size);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+
+    commandQueue->destroy();
+    context->freeMem(ptr);
+}
+
 HWTEST_F(ContextMakeMemoryResidentAndMigrationTests,
          whenExecutingImmediateCommandListsHavingSharedAllocationWithMigrationThenMemoryFromMakeResidentIsMovedToGpu) {
     DriverHandleImp *driverHandleImp = static_cast<DriverHandleImp *>(hostDriverHandle.get());
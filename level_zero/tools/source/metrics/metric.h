@@ -127,7 +127,11 @@ struct MetricStreamer : _zet_metric_streamer_handle_t {
         return static_cast<MetricStreamer *>(handle);
     }
 
+    // Host synchronization waits for notification in slices of at most maxNotificationWaitNs.
+    static constexpr uint64_t maxNotificationWaitNs = 10 * 1000 * 1000;
+
     virtual Event::State getNotificationState() = 0;
+    virtual ze_result_t waitForNotification(uint64_t timeoutNs) = 0;
     inline zet_metric_streamer_handle_t toHandle() { return this; }
 };
 
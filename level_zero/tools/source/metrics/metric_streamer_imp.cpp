@@ -13,6 +13,10 @@
 #include "level_zero/tools/source/metrics/metric_enumeration_imp.h"
 #include "level_zero/tools/source/metrics/metric_query_imp.h"
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
 namespace L0 {
 
 ze_result_t MetricStreamerImp::readData(uint32_t maxReportCount, size_t *pRawDataSize,
@@ -220,6 +224,35 @@ Event::State MetricStreamerImp::getNotificationState() {
                : Event::State::STATE_INITIAL;
 }
 
+ze_result_t MetricStreamerImp::waitForNotification(uint64_t timeoutNs) {
+    // Block on the oa stream until reports are available or the timeout expires.
+    const uint64_t timeoutMs64 = timeoutNs / 1000000 + ((timeoutNs % 1000000) ? 1 : 0);
+    const uint32_t timeoutMs = static_cast<uint32_t>(std::min<uint64_t>(timeoutMs64, std::numeric_limits<uint32_t>::max()));
+
+    if (metricStreamers.empty()) {
+        auto metricGroup = MetricGroup::fromHandle(hMetricGroup);
+        return metricGroup->waitForReports(timeoutMs);
+    }
+
+    // Reports on any sub device signal the notification. Sub device oa streams are polled
+    // round-robin in short slices, so reports on one of them are not delayed by waiting on the others.
+    const auto waitStart = std::chrono::steady_clock::now();
+    uint32_t sliceMs = 0;
+    while (true) {
+        for (auto metricStreamer : metricStreamers) {
+            auto metricGroup = MetricGroup::fromHandle(static_cast<MetricStreamerImp *>(MetricStreamer::fromHandle(metricStreamer))->hMetricGroup);
+            if (metricGroup->waitForReports(sliceMs) == ZE_RESULT_SUCCESS) {
+                return ZE_RESULT_SUCCESS;
+            }
+        }
+        const auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - waitStart).count();
+        if (static_cast<uint64_t>(elapsedMs) >= timeoutMs) {
+            return ZE_RESULT_NOT_READY;
+        }
+        sliceMs = subDeviceWaitSliceMs;
+    }
+}
+
 std::vector<zet_metric_streamer_handle_t> &MetricStreamerImp::getMetricStreamers() {
     return metricStreamers;
 }
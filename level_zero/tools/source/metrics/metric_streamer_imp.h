@@ -22,11 +22,15 @@ struct MetricStreamerImp : MetricStreamer {
     ze_result_t initialize(ze_device_handle_t hDevice, zet_metric_group_handle_t hMetricGroup);
     ze_result_t startMeasurements(uint32_t &notifyEveryNReports, uint32_t &samplingPeriodNs);
     Event::State getNotificationState() override;
+    ze_result_t waitForNotification(uint64_t timeoutNs) override;
     void attachEvent(ze_event_handle_t hNotificationEvent);
     void detachEvent();
 
     std::vector<zet_metric_streamer_handle_t> &getMetricStreamers();
 
+    // Wait slice of a single sub device oa stream, when all of them are polled round-robin.
+    static constexpr uint32_t subDeviceWaitSliceMs = 1;
+
   protected:
     ze_result_t stopMeasurements();
     uint32_t getOaBufferSize(const uint32_t notifyEveryNReports) const;
@@ -11,6 +11,8 @@
 #include "shared/source/helpers/debug_helpers.h"
 
 #include "level_zero/tools/source/sysman/engine/engine_imp.h"
+
+#include <algorithm>
 class OsEngine;
 namespace L0 {
 
@@ -23,7 +25,12 @@ EngineHandleContext::~EngineHandleContext() {
 }
 
 void EngineHandleContext::createHandle(zes_engine_group_t engineType, uint32_t engineInstance, uint32_t subDeviceId) {
-    Engine *pEngine = new EngineImp(pOsSysman, engineType, engineInstance, subDeviceId);
+    auto pEngine = new EngineImp(pOsSysman, engineType, engineInstance, subDeviceId);
+    if (nullptr != pTelemetrySampler) {
+        pEngine->enableTelemetrySampling(*pTelemetrySampler);
+    } else {
+        pEngine->enableGroupedSampling(*this, static_cast<uint32_t>(handleList.size()));
+    }
     handleList.push_back(pEngine);
 }
 
@@ -32,6 +39,7 @@ void EngineHandleContext::init() {
     OsEngine::getNumEngineTypeAndInstances(engineGroupInstance, pOsSysman);
     for (auto itr = engineGroupInstance.begin(); itr != engineGroupInstance.end(); ++itr) {
         createHandle(itr->first, itr->second.first, itr->second.second);
+        engineList.push_back(*itr);
     }
 }
 
@@ -40,6 +48,12 @@ void EngineHandleContext::releaseEngines() {
         delete pEngine;
     }
     handleList.clear();
+    engineList.clear();
+    std::lock_guard<std::mutex> lock(engineGroupMutex);
+    pOsEngineGroup.reset();
+    engineGroupCreated = false;
+    groupedStats.clear();
+    groupedStatsConsumed.clear();
 }
 
 ze_result_t EngineHandleContext::engineGet(uint32_t *pCount, zes_engine_handle_t *phEngine) {
@@ -56,4 +70,36 @@ ze_result_t EngineHandleContext::engineGet(uint32_t *pCount, zes_engine_handle_t
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t EngineHandleContext::engineGetGroupedActivity(uint32_t engineIndex, zes_engine_stats_t *pStats) {
+    std::lock_guard<std::mutex> lock(engineGroupMutex);
+    // Engine counters are grouped on first use, so devices never sampled don't hold extra counters
+    if (!engineGroupCreated) {
+        engineGroupCreated = true;
+        if (engineList.size() == handleList.size()) {
+            pOsEngineGroup.reset(OsEngineGroup::create(pOsSysman, engineList));
+        }
+        groupedStats.resize(engineList.size());
+        groupedStatsConsumed.assign(engineList.size(), true);
+    }
+    if ((pOsEngineGroup == nullptr) || (engineIndex >= groupedStats.size())) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    // Engines polled in turn share one group read, an engine asking again gets a new one
+    auto now = std::chrono::steady_clock::now();
+    if (groupedStatsConsumed[engineIndex] || (now - groupedStatsReadTime > groupedSampleValidity)) {
+        ze_result_t result = pOsEngineGroup->getActivity(static_cast<uint32_t>(groupedStats.size()), groupedStats.data());
+        if (ZE_RESULT_SUCCESS != result) {
+            // Engines keep reading their own counters from now on
+            pOsEngineGroup.reset();
+            return result;
+        }
+        groupedStatsReadTime = now;
+        std::fill(groupedStatsConsumed.begin(), groupedStatsConsumed.end(), false);
+    }
+    groupedStatsConsumed[engineIndex] = true;
+    *pStats = groupedStats[engineIndex];
+    return ZE_RESULT_SUCCESS;
+}
+
 } // namespace L0
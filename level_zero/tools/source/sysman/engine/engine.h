@@ -8,7 +8,10 @@
 #pragma once
 #include <level_zero/zes_api.h>
 
+#include <chrono>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 struct _zes_engine_handle_t {
@@ -18,6 +21,8 @@ struct _zes_engine_handle_t {
 namespace L0 {
 using EngineInstanceSubDeviceId = std::pair<uint32_t, uint32_t>;
 struct OsSysman;
+class OsEngineGroup;
+class TelemetrySampler;
 
 class Engine : _zes_engine_handle_t {
   public:
@@ -38,12 +43,23 @@ struct EngineHandleContext {
     void releaseEngines();
 
     ze_result_t engineGet(uint32_t *pCount, zes_engine_handle_t *phEngine);
+    ze_result_t engineGetGroupedActivity(uint32_t engineIndex, zes_engine_stats_t *pStats);
 
     OsSysman *pOsSysman = nullptr;
+    TelemetrySampler *pTelemetrySampler = nullptr;
     std::vector<Engine *> handleList = {};
+    std::unique_ptr<OsEngineGroup> pOsEngineGroup;
+    // Group sample is shared by engines polled one after another, older samples are read again
+    std::chrono::microseconds groupedSampleValidity = std::chrono::milliseconds(10);
 
   private:
     void createHandle(zes_engine_group_t engineType, uint32_t engineInstance, uint32_t subDeviceId);
+    std::vector<std::pair<zes_engine_group_t, EngineInstanceSubDeviceId>> engineList = {};
+    std::mutex engineGroupMutex;
+    bool engineGroupCreated = false;
+    std::vector<zes_engine_stats_t> groupedStats;
+    std::vector<bool> groupedStatsConsumed;
+    std::chrono::steady_clock::time_point groupedStatsReadTime;
 };
 
 } // namespace L0
@@ -11,6 +11,12 @@
 namespace L0 {
 
 ze_result_t EngineImp::engineGetActivity(zes_engine_stats_t *pStats) {
+    if ((nullptr != pActivityChannel) && pActivityChannel->readLatest(*pStats)) {
+        return ZE_RESULT_SUCCESS;
+    }
+    if ((nullptr != pEngineHandleContext) && (ZE_RESULT_SUCCESS == pEngineHandleContext->engineGetGroupedActivity(engineIndex, pStats))) {
+        return ZE_RESULT_SUCCESS;
+    }
     return pOsEngine->getActivity(pStats);
 }
 
@@ -28,7 +34,22 @@ EngineImp::EngineImp(OsSysman *pOsSysman, zes_engine_group_t engineType, uint32_
     init();
 }
 
+void EngineImp::enableTelemetrySampling(TelemetrySampler &sampler) {
+    pTelemetrySampler = &sampler;
+    pActivityChannel = sampler.addChannel<zes_engine_stats_t>([this](zes_engine_stats_t &stats) {
+        return pOsEngine->getActivity(&stats);
+    });
+}
+
+void EngineImp::enableGroupedSampling(EngineHandleContext &context, uint32_t engineIndex) {
+    pEngineHandleContext = &context;
+    this->engineIndex = engineIndex;
+}
+
 EngineImp::~EngineImp() {
+    if (nullptr != pTelemetrySampler) {
+        pTelemetrySampler->removeChannel(pActivityChannel);
+    }
     if (nullptr != pOsEngine) {
         delete pOsEngine;
         pOsEngine = nullptr;
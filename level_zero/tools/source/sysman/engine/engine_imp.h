@@ -11,6 +11,7 @@
 
 #include "level_zero/tools/source/sysman/engine/engine.h"
 #include "level_zero/tools/source/sysman/engine/os_engine.h"
+#include "level_zero/tools/source/sysman/telemetry_sampler.h"
 #include <level_zero/zes_api.h>
 namespace L0 {
 
@@ -25,8 +26,14 @@ class EngineImp : public Engine, NEO::NonCopyableOrMovableClass {
 
     OsEngine *pOsEngine = nullptr;
     void init();
+    void enableTelemetrySampling(TelemetrySampler &sampler);
+    void enableGroupedSampling(EngineHandleContext &context, uint32_t engineIndex);
 
   private:
     zes_engine_properties_t engineProperties = {};
+    TelemetrySampler *pTelemetrySampler = nullptr;
+    TelemetryChannel<zes_engine_stats_t> *pActivityChannel = nullptr;
+    EngineHandleContext *pEngineHandleContext = nullptr;
+    uint32_t engineIndex = 0;
 };
 } // namespace L0
@@ -46,6 +46,7 @@ ze_result_t OsEngine::getNumEngineTypeAndInstances(std::set<std::pair<zes_engine
 }
 
 ze_result_t LinuxEngineImp::getActivity(zes_engine_stats_t *pStats) {
+    std::call_once(fdOpened, [this] { init(); });
     if (fd < 0) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
@@ -77,7 +78,82 @@ LinuxEngineImp::LinuxEngineImp(OsSysman *pOsSysman, zes_engine_group_t type, uin
     pDrm = &pLinuxSysmanImp->getDrm();
     pDevice = pLinuxSysmanImp->getDeviceHandle();
     pPmuInterface = pLinuxSysmanImp->getPmuInterface();
-    init();
+}
+
+LinuxEngineGroupImp::LinuxEngineGroupImp(OsSysman *pOsSysman, const std::vector<std::pair<zes_engine_group_t, EngineInstanceSubDeviceId>> &engines) {
+    LinuxSysmanImp *pLinuxSysmanImp = static_cast<LinuxSysmanImp *>(pOsSysman);
+    pPmuInterface = pLinuxSysmanImp->getPmuInterface();
+    engineCount = static_cast<uint32_t>(engines.size());
+
+    for (uint32_t engineIndex = 0; engineIndex < engineCount; engineIndex++) {
+        auto engineGroup = engines[engineIndex].first;
+        auto engineInstance = engines[engineIndex].second.first;
+        auto &group = groups[engines[engineIndex].second.second];
+
+        auto i915EngineClass = engineToI915Map.find(engineGroup);
+        if (i915EngineClass == engineToI915Map.end()) {
+            valid = false;
+            return;
+        }
+        auto config = I915_PMU_ENGINE_BUSY(i915EngineClass->second, engineInstance);
+        // Group leader defines read format for the whole group, members are opened with group leader fd
+        int64_t fd = pPmuInterface->pmuInterfaceOpen(config, static_cast<int>(group.leaderFd),
+                                                     PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_GROUP);
+        if (fd < 0) {
+            valid = false;
+            return;
+        }
+        if (group.leaderFd < 0) {
+            group.leaderFd = fd;
+        } else {
+            group.memberFds.push_back(fd);
+        }
+        group.engineIndices.push_back(engineIndex);
+    }
+}
+
+LinuxEngineGroupImp::~LinuxEngineGroupImp() {
+    for (auto &group : groups) {
+        for (auto memberFd : group.second.memberFds) {
+            close(static_cast<int>(memberFd));
+        }
+        if (group.second.leaderFd != -1) {
+            close(static_cast<int>(group.second.leaderFd));
+        }
+    }
+}
+
+ze_result_t LinuxEngineGroupImp::getActivity(uint32_t count, zes_engine_stats_t *pStats) {
+    if (count != engineCount) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    std::vector<uint64_t> data;
+    for (auto &group : groups) {
+        auto counterCount = group.second.engineIndices.size();
+        // Group read layout is: number of counters, total time enabled, value of each counter in opening order
+        data.assign(2 + counterCount, 0u);
+        if (pPmuInterface->pmuRead(static_cast<int>(group.second.leaderFd), data.data(), static_cast<ssize_t>(data.size() * sizeof(uint64_t))) < 0) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+        if (data[0] != counterCount) {
+            return ZE_RESULT_ERROR_UNKNOWN;
+        }
+        for (size_t counter = 0; counter < counterCount; counter++) {
+            auto &stats = pStats[group.second.engineIndices[counter]];
+            stats.activeTime = data[2 + counter] / microSecondsToNanoSeconds;
+            stats.timestamp = data[1] / microSecondsToNanoSeconds;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+OsEngineGroup *OsEngineGroup::create(OsSysman *pOsSysman, const std::vector<std::pair<zes_engine_group_t, EngineInstanceSubDeviceId>> &engines) {
+    auto pLinuxEngineGroupImp = new LinuxEngineGroupImp(pOsSysman, engines);
+    if (!pLinuxEngineGroupImp->isValid()) {
+        delete pLinuxEngineGroupImp;
+        return nullptr;
+    }
+    return pLinuxEngineGroupImp;
 }
 
 OsEngine *OsEngine::create(OsSysman *pOsSysman, zes_engine_group_t type, uint32_t engineInstance, uint32_t subDeviceId) {
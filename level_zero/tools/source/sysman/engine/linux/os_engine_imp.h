@@ -12,6 +12,9 @@
 #include "level_zero/tools/source/sysman/sysman_const.h"
 
 #include "sysman/engine/os_engine.h"
+
+#include <map>
+#include <mutex>
 namespace L0 {
 class PmuInterface;
 struct Device;
@@ -40,7 +43,31 @@ class LinuxEngineImp : public OsEngine, NEO::NonCopyableOrMovableClass {
 
   private:
     void init();
+    // Counter is opened on first read, engines sampled through LinuxEngineGroupImp never open it
+    std::once_flag fdOpened;
     int64_t fd = -1;
 };
 
+// Opens engine busy counters of each sub device as one perf event group (PERF_FORMAT_GROUP),
+// so a single read of the group leader returns a consistent snapshot of all its engines
+class LinuxEngineGroupImp : public OsEngineGroup, NEO::NonCopyableOrMovableClass {
+  public:
+    ze_result_t getActivity(uint32_t count, zes_engine_stats_t *pStats) override;
+    LinuxEngineGroupImp() = default;
+    LinuxEngineGroupImp(OsSysman *pOsSysman, const std::vector<std::pair<zes_engine_group_t, EngineInstanceSubDeviceId>> &engines);
+    ~LinuxEngineGroupImp() override;
+    bool isValid() const { return valid; }
+
+  protected:
+    struct PmuGroup {
+        int64_t leaderFd = -1;
+        std::vector<int64_t> memberFds;
+        std::vector<uint32_t> engineIndices; // index of each group counter in the engines list
+    };
+    PmuInterface *pPmuInterface = nullptr;
+    std::map<uint32_t, PmuGroup> groups; // keyed by sub device id
+    uint32_t engineCount = 0;
+    bool valid = true;
+};
+
 } // namespace L0
@@ -11,6 +11,7 @@
 #include <level_zero/zes_api.h>
 
 #include <set>
+#include <vector>
 
 namespace L0 {
 
@@ -26,4 +27,13 @@ class OsEngine {
     virtual ~OsEngine() = default;
 };
 
+// Samples all engines of a device with a single read, so stats are consistent across engines.
+// Returns nullptr from create when the OS cannot group engine counters.
+class OsEngineGroup {
+  public:
+    virtual ze_result_t getActivity(uint32_t count, zes_engine_stats_t *pStats) = 0;
+    static OsEngineGroup *create(OsSysman *pOsSysman, const std::vector<std::pair<zes_engine_group_t, EngineInstanceSubDeviceId>> &engines);
+    virtual ~OsEngineGroup() = default;
+};
+
 } // namespace L0
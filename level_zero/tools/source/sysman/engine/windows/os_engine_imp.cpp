@@ -99,4 +99,8 @@ ze_result_t OsEngine::getNumEngineTypeAndInstances(std::set<std::pair<zes_engine
     return status;
 }
 
+OsEngineGroup *OsEngineGroup::create(OsSysman *pOsSysman, const std::vector<std::pair<zes_engine_group_t, EngineInstanceSubDeviceId>> &engines) {
+    return nullptr;
+}
+
 } // namespace L0
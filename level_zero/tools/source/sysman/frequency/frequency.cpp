@@ -21,7 +21,10 @@ FrequencyHandleContext::~FrequencyHandleContext() {
 }
 
 void FrequencyHandleContext::createHandle(ze_device_handle_t deviceHandle, zes_freq_domain_t frequencyDomain) {
-    Frequency *pFrequency = new FrequencyImp(pOsSysman, deviceHandle, frequencyDomain);
+    auto pFrequency = new FrequencyImp(pOsSysman, deviceHandle, frequencyDomain);
+    if (nullptr != pTelemetrySampler) {
+        pFrequency->enableTelemetrySampling(*pTelemetrySampler);
+    }
     handleList.push_back(pFrequency);
 }
 
@@ -20,6 +20,7 @@ namespace L0 {
 constexpr double unsupportedProperty = -1.0;
 
 struct OsSysman;
+class TelemetrySampler;
 
 class Frequency : _zes_freq_handle_t {
   public:
@@ -60,6 +61,7 @@ struct FrequencyHandleContext {
     ze_result_t frequencyGet(uint32_t *pCount, zes_freq_handle_t *phFrequency);
 
     OsSysman *pOsSysman = nullptr;
+    TelemetrySampler *pTelemetrySampler = nullptr;
     std::vector<Frequency *> handleList = {};
 
   private:
@@ -52,6 +52,9 @@ ze_result_t FrequencyImp::frequencySetRange(const zes_freq_range_t *pLimits) {
 }
 
 ze_result_t FrequencyImp::frequencyGetState(zes_freq_state_t *pState) {
+    if ((nullptr != pFrequencyStateChannel) && pFrequencyStateChannel->readLatest(*pState)) {
+        return ZE_RESULT_SUCCESS;
+    }
     return pOsFrequency->osFrequencyGetState(pState);
 }
 
@@ -123,7 +126,17 @@ FrequencyImp::FrequencyImp(OsSysman *pOsSysman, ze_device_handle_t handle, zes_f
     init();
 }
 
+void FrequencyImp::enableTelemetrySampling(TelemetrySampler &sampler) {
+    pTelemetrySampler = &sampler;
+    pFrequencyStateChannel = sampler.addChannel<zes_freq_state_t>([this](zes_freq_state_t &state) {
+        return pOsFrequency->osFrequencyGetState(&state);
+    });
+}
+
 FrequencyImp::~FrequencyImp() {
+    if (nullptr != pTelemetrySampler) {
+        pTelemetrySampler->removeChannel(pFrequencyStateChannel);
+    }
     delete pOsFrequency;
     delete[] pClocks;
 }
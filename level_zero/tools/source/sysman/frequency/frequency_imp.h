@@ -11,6 +11,7 @@
 
 #include "level_zero/tools/source/sysman/frequency/frequency.h"
 #include "level_zero/tools/source/sysman/frequency/os_frequency.h"
+#include "level_zero/tools/source/sysman/telemetry_sampler.h"
 #include <level_zero/zes_api.h>
 
 namespace L0 {
@@ -42,8 +43,11 @@ class FrequencyImp : public Frequency, NEO::NonCopyableOrMovableClass {
     ~FrequencyImp() override;
     OsFrequency *pOsFrequency = nullptr;
     void init();
+    void enableTelemetrySampling(TelemetrySampler &sampler);
 
   private:
+    TelemetrySampler *pTelemetrySampler = nullptr;
+    TelemetryChannel<zes_freq_state_t> *pFrequencyStateChannel = nullptr;
     zes_freq_properties_t zesFrequencyProperties = {};
     double *pClocks = nullptr;
     uint32_t numClocks = 0;
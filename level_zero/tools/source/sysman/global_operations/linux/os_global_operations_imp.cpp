@@ -15,7 +15,10 @@
 #include "level_zero/tools/source/sysman/sysman_const.h"
 #include <level_zero/zet_api.h>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <thread>
 #include <time.h>
 
 namespace L0 {
@@ -121,11 +124,54 @@ static void getPidFdsForOpenDevice(ProcfsAccess *pProcfsAccess, SysfsAccess *pSy
     }
 }
 
+void LinuxGlobalOperationsImp::forEachInParallel(size_t count, const std::function<void(size_t)> &work) {
+    // Listing and resolving /proc and sysfs entries dominates on hosts with many processes or clients,
+    // so large lists are split across threads. Each index is processed exactly once.
+    size_t threadCount = std::min(static_cast<size_t>(std::min(maxProcessScanThreads, std::max(std::thread::hardware_concurrency(), 1u))),
+                                  count / std::max(minProcessesPerScanThread, static_cast<size_t>(1u)));
+    if (threadCount <= 1) {
+        for (size_t i = 0; i < count; i++) {
+            work(i);
+        }
+        return;
+    }
+
+    std::atomic<size_t> nextIndex{0};
+    auto processIndices = [&]() {
+        for (size_t i = nextIndex++; i < count; i = nextIndex++) {
+            work(i);
+        }
+    };
+    std::vector<std::thread> scanThreads;
+    for (size_t thread = 1; thread < threadCount; thread++) {
+        scanThreads.emplace_back(processIndices);
+    }
+    processIndices();
+    for (auto &scanThread : scanThreads) {
+        scanThread.join();
+    }
+}
+
+void LinuxGlobalOperationsImp::getDeviceFdsOfProcesses(const std::vector<::pid_t> &processes, std::vector<std::vector<int>> &deviceFds) {
+    // deviceFds[i] belongs to processes[i]
+    deviceFds.assign(processes.size(), {});
+    forEachInParallel(processes.size(), [&](size_t i) {
+        getPidFdsForOpenDevice(pProcfsAccess, pSysfsAccess, processes[i], deviceFds[i]);
+    });
+}
+
 void LinuxGlobalOperationsImp::releaseSysmanDeviceResources() {
+    // Sampler thread reads engine and PMT backed handles released below
+    if (nullptr != pLinuxSysmanImp->getSysmanDeviceImp()->pTelemetrySampler) {
+        pLinuxSysmanImp->getSysmanDeviceImp()->pTelemetrySampler->stop();
+    }
     pLinuxSysmanImp->getSysmanDeviceImp()->pEngineHandleContext->releaseEngines();
     pLinuxSysmanImp->getSysmanDeviceImp()->pRasHandleContext->releaseRasHandles();
     pLinuxSysmanImp->getSysmanDeviceImp()->pDiagnosticsHandleContext->releaseDiagnosticsHandles();
     pLinuxSysmanImp->getSysmanDeviceImp()->pFirmwareHandleContext->releaseFwHandles();
+    // Temperature and power handles keep pointers to PMT objects
+    pLinuxSysmanImp->getSysmanDeviceImp()->pTempHandleContext->releaseTemperatureHandles();
+    pLinuxSysmanImp->getSysmanDeviceImp()->pPowerHandleContext->releasePowerHandles();
     pLinuxSysmanImp->releasePmtObject();
     pLinuxSysmanImp->releaseFwUtilInterface();
     pLinuxSysmanImp->releaseLocalDrmHandle();
@@ -143,10 +189,15 @@ void LinuxGlobalOperationsImp::releaseDeviceResources() {
 void LinuxGlobalOperationsImp::reInitSysmanDeviceResources() {
     pLinuxSysmanImp->getSysmanDeviceImp()->updateSubDeviceHandlesLocally();
     pLinuxSysmanImp->createPmtHandles();
+    pLinuxSysmanImp->getSysmanDeviceImp()->pPowerHandleContext->init(pLinuxSysmanImp->getSysmanDeviceImp()->deviceHandles, pLinuxSysmanImp->getSysmanDeviceImp()->hCoreDevice);
+    pLinuxSysmanImp->getSysmanDeviceImp()->pTempHandleContext->init(pLinuxSysmanImp->getSysmanDeviceImp()->deviceHandles);
     pLinuxSysmanImp->getSysmanDeviceImp()->pRasHandleContext->init(pLinuxSysmanImp->getSysmanDeviceImp()->deviceHandles);
     pLinuxSysmanImp->getSysmanDeviceImp()->pEngineHandleContext->init();
     pLinuxSysmanImp->getSysmanDeviceImp()->pDiagnosticsHandleContext->init(pLinuxSysmanImp->getSysmanDeviceImp()->deviceHandles);
     pLinuxSysmanImp->getSysmanDeviceImp()->pFirmwareHandleContext->init();
+    if (nullptr != pLinuxSysmanImp->getSysmanDeviceImp()->pTelemetrySampler) {
+        pLinuxSysmanImp->getSysmanDeviceImp()->pTelemetrySampler->start();
+    }
 }
 
 ze_result_t LinuxGlobalOperationsImp::initDevice() {
@@ -181,14 +232,16 @@ ze_result_t LinuxGlobalOperationsImp::reset(ze_bool_t force) {
     ::pid_t myPid = pProcfsAccess->myProcessId();
     std::vector<int> myPidFds;
     std::vector<::pid_t> processes;
+    std::vector<std::vector<int>> processesFds;
 
     result = pProcfsAccess->listProcesses(processes);
     if (ZE_RESULT_SUCCESS != result) {
         return result;
     }
-    for (auto &&pid : processes) {
-        std::vector<int> fds;
-        getPidFdsForOpenDevice(pProcfsAccess, pSysfsAccess, pid, fds);
+    getDeviceFdsOfProcesses(processes, processesFds);
+    for (size_t i = 0; i < processes.size(); i++) {
+        auto pid = processes[i];
+        auto &fds = processesFds[i];
         if (pid == myPid) {
             // L0 is expected to have this file open.
             // Keep list of fds. Close before unbind.
@@ -230,10 +283,10 @@ ze_result_t LinuxGlobalOperationsImp::reset(ze_bool_t force) {
     }
     std::vector<::pid_t> deviceUsingPids;
     deviceUsingPids.clear();
-    for (auto &&pid : processes) {
-        std::vector<int> fds;
-        getPidFdsForOpenDevice(pProcfsAccess, pSysfsAccess, pid, fds);
-        if (!fds.empty()) {
+    getDeviceFdsOfProcesses(processes, processesFds);
+    for (size_t i = 0; i < processes.size(); i++) {
+        auto pid = processes[i];
+        if (!processesFds[i].empty()) {
 
             // Kill all processes that have the device open.
             pProcfsAccess->kill(pid);
@@ -290,6 +343,95 @@ ze_result_t LinuxGlobalOperationsImp::reset(ze_bool_t force) {
 // accumulated nanoseconds each client spent on engines.
 // Thus we traverse each file in busy dir for non-zero time and if we find that file say 0,then we could say that
 // this engine 0 is used by process.
+ze_result_t LinuxGlobalOperationsImp::scanClientState(const std::string &clientId, ClientState &clientState) {
+    // realClientPidPath will be something like: clients/<clientId>/pid
+    std::string realClientPidPath = clientsDir + "/" + clientId + "/" + "pid";
+    uint64_t pid;
+    ze_result_t result = pSysfsAccess->read(realClientPidPath, pid);
+
+    if (ZE_RESULT_SUCCESS != result) {
+        std::string bPidString;
+        result = pSysfsAccess->read(realClientPidPath, bPidString);
+        if (result == ZE_RESULT_SUCCESS) {
+            size_t start = bPidString.find("<");
+            size_t end = bPidString.find(">");
+            std::string bPid = bPidString.substr(start + 1, end - start - 1);
+            pid = std::stoull(bPid, nullptr, 10);
+        }
+    }
+
+    if (ZE_RESULT_SUCCESS != result) {
+        if (ZE_RESULT_ERROR_NOT_AVAILABLE == result) {
+            // ZE_RESULT_ERROR_NOT_AVAILABLE is expected if the "realClientPidPath" folder is empty
+            // this condition(when encountered) must not prevent the information accumulated for other clientIds
+            return ZE_RESULT_SUCCESS;
+        } else {
+            return result;
+        }
+    }
+    // Traverse the clients/<clientId>/busy directory to get accelerator engines used by process
+    std::vector<std::string> engineNums = {};
+    int64_t engineType = 0;
+    std::string busyDirForEngines = clientsDir + "/" + clientId + "/" + "busy";
+    result = pSysfsAccess->scanDirEntries(busyDirForEngines, engineNums);
+    if (ZE_RESULT_SUCCESS != result) {
+        if (ZE_RESULT_ERROR_NOT_AVAILABLE == result) {
+            // update the result as Success as ZE_RESULT_ERROR_NOT_AVAILABLE is expected if the "realClientPidPath" folder is empty
+            // this condition(when encountered) must not prevent the information accumulated for other clientIds
+            // this situation occurs when there is no call modifying result,
+            // Here its seen when the last element of clientIds returns ZE_RESULT_ERROR_NOT_AVAILABLE for some reason.
+            engineType = ZES_ENGINE_TYPE_FLAG_OTHER; // When busy node is absent assign engine type with ZES_ENGINE_TYPE_FLAG_OTHER
+        } else {
+            return result;
+        }
+    }
+    // Scan all engine files present in /sys/class/drm/card0/clients/<ClientId>/busy and check
+    // whether that engine is used by process
+    for (const auto &engineNum : engineNums) {
+        uint64_t timeSpent = 0;
+        std::string engine = busyDirForEngines + "/" + engineNum;
+        result = pSysfsAccess->read(engine, timeSpent);
+        if (ZE_RESULT_SUCCESS != result) {
+            if (ZE_RESULT_ERROR_NOT_AVAILABLE == result) {
+                continue;
+            } else {
+                return result;
+            }
+        }
+        if (timeSpent > 0) {
+            int i915EnginNumber = stoi(engineNum);
+            auto i915MapToL0EngineType = engineMap.find(i915EnginNumber);
+            zes_engine_type_flags_t val = ZES_ENGINE_TYPE_FLAG_OTHER;
+            if (i915MapToL0EngineType != engineMap.end()) {
+                // Found a valid map
+                val = i915MapToL0EngineType->second;
+            }
+            // In this for loop we want to retrieve the overall engines used by process
+            engineType = engineType | val;
+        }
+    }
+
+    uint64_t memSize = 0;
+    std::string realClientTotalMemoryPath = clientsDir + "/" + clientId + "/" + "total_device_memory_buffer_objects" + "/" + "created_bytes";
+    result = pSysfsAccess->read(realClientTotalMemoryPath, memSize);
+    if (ZE_RESULT_SUCCESS != result) {
+        if (ZE_RESULT_ERROR_NOT_AVAILABLE != result) {
+            return result;
+        }
+    }
+
+    uint64_t sharedMemSize = 0;
+    std::string realClientTotalSharedMemoryPath = clientsDir + "/" + clientId + "/" + "total_device_memory_buffer_objects" + "/" + "imported_bytes";
+    result = pSysfsAccess->read(realClientTotalSharedMemoryPath, sharedMemSize);
+    if (ZE_RESULT_SUCCESS != result) {
+        if (ZE_RESULT_ERROR_NOT_AVAILABLE != result) {
+            return result;
+        }
+    }
+    clientState = {true, pid, engineType, memSize, sharedMemSize};
+    return ZE_RESULT_SUCCESS;
+}
+
 ze_result_t LinuxGlobalOperationsImp::scanProcessesState(std::vector<zes_process_state_t> &pProcessList) {
     std::vector<std::string> clientIds;
     struct deviceMemStruct {
@@ -308,95 +450,24 @@ ze_result_t LinuxGlobalOperationsImp::scanProcessesState(std::vector<zes_process
 
     // Create a map with unique pid as key and engineType as value
     std::map<uint64_t, engineMemoryPairType> pidClientMap;
-    for (const auto &clientId : clientIds) {
-        // realClientPidPath will be something like: clients/<clientId>/pid
-        std::string realClientPidPath = clientsDir + "/" + clientId + "/" + "pid";
-        uint64_t pid;
-        result = pSysfsAccess->read(realClientPidPath, pid);
-
-        if (ZE_RESULT_SUCCESS != result) {
-            std::string bPidString;
-            result = pSysfsAccess->read(realClientPidPath, bPidString);
-            if (result == ZE_RESULT_SUCCESS) {
-                size_t start = bPidString.find("<");
-                size_t end = bPidString.find(">");
-                std::string bPid = bPidString.substr(start + 1, end - start - 1);
-                pid = std::stoull(bPid, nullptr, 10);
-            }
-        }
-
-        if (ZE_RESULT_SUCCESS != result) {
-            if (ZE_RESULT_ERROR_NOT_AVAILABLE == result) {
-                // update the result as Success as ZE_RESULT_ERROR_NOT_AVAILABLE is expected if the "realClientPidPath" folder is empty
-                // this condition(when encountered) must not prevent the information accumulated for other clientIds
-                // this situation occurs when there is no call modifying result,
-                result = ZE_RESULT_SUCCESS;
-                continue;
-            } else {
-                return result;
-            }
+    // Clients are read in parallel and merged in directory order, so results match a sequential scan
+    std::vector<ClientState> clientStates(clientIds.size());
+    std::vector<ze_result_t> clientResults(clientIds.size(), ZE_RESULT_SUCCESS);
+    forEachInParallel(clientIds.size(), [&](size_t i) {
+        clientResults[i] = scanClientState(clientIds[i], clientStates[i]);
+    });
+
+    for (size_t clientIndex = 0; clientIndex < clientIds.size(); clientIndex++) {
+        if (ZE_RESULT_SUCCESS != clientResults[clientIndex]) {
+            return clientResults[clientIndex];
         }
-        // Traverse the clients/<clientId>/busy directory to get accelerator engines used by process
-        std::vector<std::string> engineNums = {};
-        int64_t engineType = 0;
-        std::string busyDirForEngines = clientsDir + "/" + clientId + "/" + "busy";
-        result = pSysfsAccess->scanDirEntries(busyDirForEngines, engineNums);
-        if (ZE_RESULT_SUCCESS != result) {
-            if (ZE_RESULT_ERROR_NOT_AVAILABLE == result) {
-                // update the result as Success as ZE_RESULT_ERROR_NOT_AVAILABLE is expected if the "realClientPidPath" folder is empty
-                // this condition(when encountered) must not prevent the information accumulated for other clientIds
-                // this situation occurs when there is no call modifying result,
-                // Here its seen when the last element of clientIds returns ZE_RESULT_ERROR_NOT_AVAILABLE for some reason.
-                engineType = ZES_ENGINE_TYPE_FLAG_OTHER; // When busy node is absent assign engine type with ZES_ENGINE_TYPE_FLAG_OTHER
-            } else {
-                return result;
-            }
-        }
-        // Scan all engine files present in /sys/class/drm/card0/clients/<ClientId>/busy and check
-        // whether that engine is used by process
-        for (const auto &engineNum : engineNums) {
-            uint64_t timeSpent = 0;
-            std::string engine = busyDirForEngines + "/" + engineNum;
-            result = pSysfsAccess->read(engine, timeSpent);
-            if (ZE_RESULT_SUCCESS != result) {
-                if (ZE_RESULT_ERROR_NOT_AVAILABLE == result) {
-                    continue;
-                } else {
-                    return result;
-                }
-            }
-            if (timeSpent > 0) {
-                int i915EnginNumber = stoi(engineNum);
-                auto i915MapToL0EngineType = engineMap.find(i915EnginNumber);
-                zes_engine_type_flags_t val = ZES_ENGINE_TYPE_FLAG_OTHER;
-                if (i915MapToL0EngineType != engineMap.end()) {
-                    // Found a valid map
-                    val = i915MapToL0EngineType->second;
-                }
-                // In this for loop we want to retrieve the overall engines used by process
-                engineType = engineType | val;
-            }
-        }
-
-        uint64_t memSize = 0;
-        std::string realClientTotalMemoryPath = clientsDir + "/" + clientId + "/" + "total_device_memory_buffer_objects" + "/" + "created_bytes";
-        result = pSysfsAccess->read(realClientTotalMemoryPath, memSize);
-        if (ZE_RESULT_SUCCESS != result) {
-            if (ZE_RESULT_ERROR_NOT_AVAILABLE != result) {
-                return result;
-            }
-        }
-
-        uint64_t sharedMemSize = 0;
-        std::string realClientTotalSharedMemoryPath = clientsDir + "/" + clientId + "/" + "total_device_memory_buffer_objects" + "/" + "imported_bytes";
-        result = pSysfsAccess->read(realClientTotalSharedMemoryPath, sharedMemSize);
-        if (ZE_RESULT_SUCCESS != result) {
-            if (ZE_RESULT_ERROR_NOT_AVAILABLE != result) {
-                return result;
-            }
+        const auto &clientState = clientStates[clientIndex];
+        if (!clientState.valid) {
+            continue;
         }
-        deviceMemStruct totalDeviceMem = {memSize, sharedMemSize};
-        engineMemoryPairType engineMemoryPair = {engineType, totalDeviceMem};
+        auto pid = clientState.pid;
+        deviceMemStruct totalDeviceMem = {clientState.memSize, clientState.sharedMemSize};
+        engineMemoryPairType engineMemoryPair = {clientState.engineType, totalDeviceMem};
         auto ret = pidClientMap.insert(std::make_pair(pid, engineMemoryPair));
         if (ret.second == false) {
             // insertion failed as entry with same pid already exists in map
@@ -9,6 +9,8 @@
 #include "level_zero/tools/source/sysman/global_operations/os_global_operations.h"
 #include "level_zero/tools/source/sysman/linux/os_sysman_imp.h"
 
+#include <functional>
+
 namespace L0 {
 class SysfsAccess;
 struct Device;
@@ -38,6 +40,18 @@ class LinuxGlobalOperationsImp : public OsGlobalOperations, NEO::NonCopyableOrMo
     LinuxSysmanImp *pLinuxSysmanImp = nullptr;
     Device *pDevice = nullptr;
     int resetTimeout = 10000; // in milliseconds
+    uint32_t maxProcessScanThreads = 8;
+    size_t minProcessesPerScanThread = 64;
+    struct ClientState {
+        bool valid = false;
+        uint64_t pid = 0;
+        int64_t engineType = 0;
+        uint64_t memSize = 0;
+        uint64_t sharedMemSize = 0;
+    };
+    void forEachInParallel(size_t count, const std::function<void(size_t)> &work);
+    void getDeviceFdsOfProcesses(const std::vector<::pid_t> &processes, std::vector<std::vector<int>> &deviceFds);
+    ze_result_t scanClientState(const std::string &clientId, ClientState &clientState);
     void releaseSysmanDeviceResources();
     void releaseDeviceResources();
     ze_result_t initDevice();
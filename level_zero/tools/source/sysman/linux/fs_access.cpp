@@ -10,11 +10,13 @@
 #include <climits>
 
 #include <array>
+#include <cctype>
 #include <cerrno>
 #include <csignal>
 #include <cstdio>
 #include <cstdlib>
 #include <dirent.h>
+#include <limits>
 #include <unistd.h>
 
 namespace L0 {
@@ -29,15 +31,155 @@ static ze_result_t getResult(int err) {
     }
 }
 
+// Parsing below mirrors std::istream extraction of a single value, without stream construction
+static bool parseValue(const char *str, uint64_t &val) {
+    char *end = nullptr;
+    errno = 0;
+    auto parsed = std::strtoull(str, &end, 10);
+    if ((end == str) || (errno == ERANGE)) {
+        return false;
+    }
+    val = static_cast<uint64_t>(parsed);
+    return true;
+}
+
+static bool parseValue(const char *str, uint32_t &val) {
+    uint64_t parsed = 0;
+    if (!parseValue(str, parsed) || (parsed > std::numeric_limits<uint32_t>::max())) {
+        return false;
+    }
+    val = static_cast<uint32_t>(parsed);
+    return true;
+}
+
+static bool parseValue(const char *str, int32_t &val) {
+    char *end = nullptr;
+    errno = 0;
+    auto parsed = std::strtol(str, &end, 10);
+    if ((end == str) || (errno == ERANGE) ||
+        (parsed > std::numeric_limits<int32_t>::max()) || (parsed < std::numeric_limits<int32_t>::min())) {
+        return false;
+    }
+    val = static_cast<int32_t>(parsed);
+    return true;
+}
+
+static bool parseValue(const char *str, double &val) {
+    char *end = nullptr;
+    errno = 0;
+    auto parsed = std::strtod(str, &end);
+    if ((end == str) || (errno == ERANGE)) {
+        return false;
+    }
+    val = parsed;
+    return true;
+}
+
+static bool parseValue(const char *str, std::string &val) {
+    // Extract first whitespace separated token
+    while (std::isspace(static_cast<unsigned char>(*str))) {
+        str++;
+    }
+    auto end = str;
+    while ((*end != '\0') && !std::isspace(static_cast<unsigned char>(*end))) {
+        end++;
+    }
+    if (end == str) {
+        return false;
+    }
+    val.assign(str, end);
+    return true;
+}
+
 // Generic Filesystem Access
 FsAccess::FsAccess() {
 }
 
+FsAccess::~FsAccess() = default;
+
 FsAccess *FsAccess::create() {
     return new FsAccess();
 }
 
+bool FsAccess::isSysfsAttribute(const std::string &file) {
+    static const std::string sysfsRoot = "/sys/";
+    return (file.compare(0, sysfsRoot.size(), sysfsRoot) == 0);
+}
+
+ze_result_t FsAccess::readSysfsAttribute(const std::string &file, char *buf, size_t bufSize) {
+    std::shared_ptr<int> fd;
+    {
+        std::lock_guard<std::mutex> lock(sysfsFdCacheMutex);
+        auto cachedFd = sysfsFdCache.find(file);
+        if (cachedFd != sysfsFdCache.end()) {
+            fd = cachedFd->second;
+            sysfsFdLru.remove(file);
+            sysfsFdLru.push_front(file);
+        }
+    }
+    if (fd) {
+        ssize_t bytesRead = preadSyscall(*fd, buf, bufSize - 1, 0);
+        if (bytesRead >= 0) {
+            buf[bytesRead] = '\0';
+            return ZE_RESULT_SUCCESS;
+        }
+        // Attribute could have been recreated, e.g. after device rebind, so retry with fresh descriptor
+        {
+            std::lock_guard<std::mutex> lock(sysfsFdCacheMutex);
+            auto cachedFd = sysfsFdCache.find(file);
+            if (cachedFd != sysfsFdCache.end() && cachedFd->second == fd) {
+                sysfsFdCache.erase(cachedFd);
+                sysfsFdLru.remove(file);
+            }
+        }
+        fd.reset();
+    }
+
+    int newFd = openSyscall(file.c_str(), O_RDONLY | O_CLOEXEC);
+    if (newFd < 0) {
+        return getResult(errno);
+    }
+    // Descriptor is closed once it is dropped from the cache and no other thread is reading it
+    auto closeFunction = closeSyscall;
+    fd = std::shared_ptr<int>(new int(newFd), [closeFunction](int *fd) {
+        closeFunction(*fd);
+        delete fd;
+    });
+    ssize_t bytesRead = preadSyscall(*fd, buf, bufSize - 1, 0);
+    if (bytesRead < 0) {
+        return getResult(errno);
+    }
+    buf[bytesRead] = '\0';
+    std::lock_guard<std::mutex> lock(sysfsFdCacheMutex);
+    if (!sysfsFdCache.emplace(file, std::move(fd)).second) {
+        return ZE_RESULT_SUCCESS;
+    }
+    sysfsFdLru.push_front(file);
+    if (sysfsFdLru.size() > maxCachedSysfsFds) {
+        // Evicted descriptor is closed once no other thread is reading it
+        sysfsFdCache.erase(sysfsFdLru.back());
+        sysfsFdLru.pop_back();
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+template <typename T>
+ze_result_t FsAccess::readSysfsValue(const std::string &file, T &val) {
+    char buf[maxSysfsAttributeSize];
+    ze_result_t result = readSysfsAttribute(file, buf, sizeof(buf));
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
+    }
+    if (!parseValue(buf, val)) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 ze_result_t FsAccess::read(const std::string file, uint64_t &val) {
+    if (isSysfsAttribute(file)) {
+        return readSysfsValue(file, val);
+    }
     // Read a single line from text file without trailing newline
     std::ifstream fs;
 
@@ -55,6 +197,9 @@ ze_result_t FsAccess::read(const std::string file, uint64_t &val) {
 }
 
 ze_result_t FsAccess::read(const std::string file, double &val) {
+    if (isSysfsAttribute(file)) {
+        return readSysfsValue(file, val);
+    }
     // Read a single line from text file without trailing newline
     std::ifstream fs;
 
@@ -72,6 +217,9 @@ ze_result_t FsAccess::read(const std::string file, double &val) {
 }
 
 ze_result_t FsAccess::read(const std::string file, int32_t &val) {
+    if (isSysfsAttribute(file)) {
+        return readSysfsValue(file, val);
+    }
     // Read a single line from text file without trailing newline
     std::ifstream fs;
 
@@ -89,6 +237,9 @@ ze_result_t FsAccess::read(const std::string file, int32_t &val) {
 }
 
 ze_result_t FsAccess::read(const std::string file, uint32_t &val) {
+    if (isSysfsAttribute(file)) {
+        return readSysfsValue(file, val);
+    }
     // Read a single line from text file without trailing newline
     std::ifstream fs;
 
@@ -105,9 +256,12 @@ ze_result_t FsAccess::read(const std::string file, uint32_t &val) {
     return ZE_RESULT_SUCCESS;
 }
 ze_result_t FsAccess::read(const std::string file, std::string &val) {
+    val.clear();
+    if (isSysfsAttribute(file)) {
+        return readSysfsValue(file, val);
+    }
     // Read a single line from text file without trailing newline
     std::ifstream fs;
-    val.clear();
 
     fs.open(file.c_str());
     if (fs.fail()) {
@@ -320,10 +474,9 @@ ze_result_t ProcfsAccess::listProcesses(std::vector<::pid_t> &list) {
         return result;
     }
     for (auto &&file : dir) {
-        ::pid_t pid;
-        std::istringstream stream(file);
-        stream >> pid;
-        if (stream.fail()) {
+        char *end = nullptr;
+        auto pid = static_cast<::pid_t>(std::strtol(file.c_str(), &end, 10));
+        if (end == file.c_str()) {
             // Non numeric filename, not a process, skip
             continue;
         }
@@ -341,10 +494,9 @@ ze_result_t ProcfsAccess::getFileDescriptors(const ::pid_t pid, std::vector<int>
         return result;
     }
     for (auto &&file : dir) {
-        int fd;
-        std::istringstream stream(file);
-        stream >> fd;
-        if (stream.fail()) {
+        char *end = nullptr;
+        auto fd = static_cast<int>(std::strtol(file.c_str(), &end, 10));
+        if (end == file.c_str()) {
             // Non numeric filename, not a file descriptor
             continue;
         }
@@ -424,75 +576,23 @@ ze_result_t SysfsAccess::read(const std::string file, std::string &val) {
 }
 
 ze_result_t SysfsAccess::read(const std::string file, int32_t &val) {
-    std::string str;
-    ze_result_t result;
-
-    result = FsAccess::read(fullPath(file), str);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
-    }
-
-    std::istringstream stream(str);
-    stream >> val;
-
-    if (stream.fail()) {
-        return ZE_RESULT_ERROR_UNKNOWN;
-    }
-    return ZE_RESULT_SUCCESS;
+    // Prepend sysfs directory path and call the base read
+    return FsAccess::read(fullPath(file), val);
 }
 
 ze_result_t SysfsAccess::read(const std::string file, uint32_t &val) {
-    std::string str;
-    ze_result_t result;
-
-    result = FsAccess::read(fullPath(file), str);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
-    }
-
-    std::istringstream stream(str);
-    stream >> val;
-
-    if (stream.fail()) {
-        return ZE_RESULT_ERROR_UNKNOWN;
-    }
-    return ZE_RESULT_SUCCESS;
+    // Prepend sysfs directory path and call the base read
+    return FsAccess::read(fullPath(file), val);
 }
 
 ze_result_t SysfsAccess::read(const std::string file, double &val) {
-    std::string str;
-    ze_result_t result;
-
-    result = FsAccess::read(fullPath(file), str);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
-    }
-
-    std::istringstream stream(str);
-    stream >> val;
-
-    if (stream.fail()) {
-        return ZE_RESULT_ERROR_UNKNOWN;
-    }
-    return ZE_RESULT_SUCCESS;
+    // Prepend sysfs directory path and call the base read
+    return FsAccess::read(fullPath(file), val);
 }
 
 ze_result_t SysfsAccess::read(const std::string file, uint64_t &val) {
-    std::string str;
-    ze_result_t result;
-
-    result = FsAccess::read(fullPath(file), str);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
-    }
-
-    std::istringstream stream(str);
-    stream >> val;
-
-    if (stream.fail()) {
-        return ZE_RESULT_ERROR_UNKNOWN;
-    }
-    return ZE_RESULT_SUCCESS;
+    // Prepend sysfs directory path and call the base read
+    return FsAccess::read(fullPath(file), val);
 }
 
 ze_result_t SysfsAccess::read(const std::string file, std::vector<std::string> &val) {
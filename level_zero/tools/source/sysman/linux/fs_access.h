@@ -12,9 +12,13 @@
 #include "level_zero/ze_api.h"
 #include "level_zero/zet_api.h"
 
+#include <fcntl.h>
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
@@ -28,7 +32,7 @@ namespace L0 {
 class FsAccess {
   public:
     static FsAccess *create();
-    virtual ~FsAccess() = default;
+    virtual ~FsAccess();
 
     virtual ze_result_t canRead(const std::string file);
     virtual ze_result_t canWrite(const std::string file);
@@ -54,8 +58,24 @@ class FsAccess {
 
   protected:
     FsAccess();
+    bool isSysfsAttribute(const std::string &file);
+    ze_result_t readSysfsAttribute(const std::string &file, char *buf, size_t bufSize);
+    template <typename T>
+    ze_result_t readSysfsValue(const std::string &file, T &val);
     decltype(&NEO::SysCalls::access) accessSyscall = NEO::SysCalls::access;
     decltype(&stat) statSyscall = stat;
+    decltype(&NEO::SysCalls::open) openSyscall = NEO::SysCalls::open;
+    decltype(&NEO::SysCalls::pread) preadSyscall = NEO::SysCalls::pread;
+    decltype(&NEO::SysCalls::close) closeSyscall = NEO::SysCalls::close;
+
+    // Sysfs attributes regenerate their content on every read from offset 0,
+    // so descriptors are kept open across reads. Per-client nodes come and go,
+    // so only the most recently read attributes stay cached.
+    std::map<std::string, std::shared_ptr<int>> sysfsFdCache;
+    std::list<std::string> sysfsFdLru;
+    std::mutex sysfsFdCacheMutex;
+    static constexpr size_t maxCachedSysfsFds = 64;
+    static constexpr size_t maxSysfsAttributeSize = 4096;
 };
 
 class ProcfsAccess : private FsAccess {
@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <errno.h>
 #include <fcntl.h>
+#include <limits>
 #include <string.h>
 
 namespace L0 {
@@ -19,48 +20,93 @@ const std::string PlatformMonitoringTech::baseTelemSysFS("/sys/class/intel_pmt")
 const std::string PlatformMonitoringTech::telem("telem");
 uint32_t PlatformMonitoringTech::rootDeviceTelemNodeIndex = 0;
 
-ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint32_t &value) {
-    auto offset = keyOffsetMap.find(key);
-    if (offset == keyOffsetMap.end()) {
-        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+ze_result_t PlatformMonitoringTech::readTelemetry(void *data, size_t size, uint64_t offset) {
+    size_t bytesRead = 0;
+    ze_result_t result = readTelemetry(data, size, offset, bytesRead);
+    if (result != ZE_RESULT_SUCCESS) {
+        return result;
     }
-    int fd = this->openFunction(telemetryDeviceEntry.c_str(), O_RDONLY);
-    if (fd == -1) {
+    if (bytesRead != size) {
+        closeTelemetryDevice();
         return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
     }
+    return ZE_RESULT_SUCCESS;
+}
 
-    ze_result_t res = ZE_RESULT_SUCCESS;
-    if (this->preadFunction(fd, &value, sizeof(uint32_t), baseOffset + offset->second) != sizeof(uint32_t)) {
-        res = ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+ze_result_t PlatformMonitoringTech::readTelemetry(void *data, size_t size, uint64_t offset, size_t &bytesRead) {
+    // fd is kept locked while reading, so it cannot be closed and reused by another thread in the meantime
+    std::lock_guard<std::mutex> lock(telemetryFdMutex);
+    if (telemetryFd == -1) {
+        // fd stays open for the process lifetime, keep it out of child processes
+        telemetryFd = this->openFunction(telemetryDeviceEntry.c_str(), O_RDONLY | O_CLOEXEC);
+        if (telemetryFd == -1) {
+            return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+        }
     }
 
-    if (this->closeFunction(fd) < 0) {
-        return ZE_RESULT_ERROR_UNKNOWN;
+    auto readResult = this->preadFunction(telemetryFd, data, size, baseOffset + offset);
+    if (readResult <= 0) {
+        // Reopen on next read, telemetry device could have been reset in the meantime
+        this->closeFunction(telemetryFd);
+        telemetryFd = -1;
+        return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
     }
+    bytesRead = static_cast<size_t>(readResult);
+    return ZE_RESULT_SUCCESS;
+}
 
-    return res;
+void PlatformMonitoringTech::closeTelemetryDevice() {
+    std::lock_guard<std::mutex> lock(telemetryFdMutex);
+    if (telemetryFd != -1) {
+        this->closeFunction(telemetryFd);
+        telemetryFd = -1;
+    }
 }
 
-ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint64_t &value) {
+ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint32_t &value) {
     auto offset = keyOffsetMap.find(key);
     if (offset == keyOffsetMap.end()) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
-    int fd = this->openFunction(telemetryDeviceEntry.c_str(), O_RDONLY);
-    if (fd == -1) {
-        return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
-    }
+    return readTelemetry(&value, sizeof(uint32_t), offset->second);
+}
 
-    ze_result_t res = ZE_RESULT_SUCCESS;
-    if (this->preadFunction(fd, &value, sizeof(uint64_t), baseOffset + offset->second) != sizeof(uint64_t)) {
-        res = ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint64_t &value) {
+    auto offset = keyOffsetMap.find(key);
+    if (offset == keyOffsetMap.end()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
+    return readTelemetry(&value, sizeof(uint64_t), offset->second);
+}
 
-    if (this->closeFunction(fd) < 0) {
-        return ZE_RESULT_ERROR_UNKNOWN;
+ze_result_t PlatformMonitoringTech::readSnapshot(const std::vector<TelemetryKey> &keys, TelemetrySnapshot &snapshot) {
+    if (keys.empty()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    uint64_t startOffset = std::numeric_limits<uint64_t>::max();
+    uint64_t endOffset = 0;
+    for (const auto &key : keys) {
+        auto offset = keyOffsetMap.find(key.name);
+        if (offset == keyOffsetMap.end()) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+        startOffset = std::min(startOffset, offset->second);
+        endOffset = std::max(endOffset, offset->second + key.size);
     }
 
-    return res;
+    std::vector<uint8_t> data(static_cast<size_t>(endOffset - startOffset));
+    size_t bytesRead = 0;
+    ze_result_t result = readTelemetry(data.data(), data.size(), startOffset, bytesRead);
+    if (result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
+    // Short read near the end of telemetry region leaves trailing keys out of the snapshot,
+    // readValueFromSnapshot reports them instead of failing the whole snapshot
+    data.resize(bytesRead);
+    snapshot.startOffset = startOffset;
+    snapshot.endOffset = endOffset;
+    snapshot.data = std::move(data);
+    return ZE_RESULT_SUCCESS;
 }
 
 bool compareTelemNodes(std::string &telemNode1, std::string &telemNode2) {
@@ -196,6 +242,7 @@ void PlatformMonitoringTech::create(const std::vector<ze_device_handle_t> &devic
 }
 
 PlatformMonitoringTech::~PlatformMonitoringTech() {
+    closeTelemetryDevice();
 }
 
 } // namespace L0
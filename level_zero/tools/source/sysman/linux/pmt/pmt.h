@@ -7,6 +7,7 @@
 
 #pragma once
 #include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/os_interface/linux/sys_calls.h"
 
 #include "level_zero/core/source/device/device.h"
@@ -14,11 +15,24 @@
 
 #include <fcntl.h>
 #include <map>
+#include <mutex>
 #include <sys/stat.h>
 #include <sys/types.h>
 
 namespace L0 {
 
+struct TelemetryKey {
+    std::string name;
+    size_t size;
+};
+
+// Raw telemetry bytes fetched with a single pread, covering the offsets of the requested keys
+struct TelemetrySnapshot {
+    uint64_t startOffset = 0;
+    uint64_t endOffset = 0; // end of the requested range, data is shorter after a short read
+    std::vector<uint8_t> data;
+};
+
 class PlatformMonitoringTech : NEO::NonCopyableOrMovableClass {
   public:
     PlatformMonitoringTech() = delete;
@@ -27,6 +41,9 @@ class PlatformMonitoringTech : NEO::NonCopyableOrMovableClass {
 
     virtual ze_result_t readValue(const std::string key, uint32_t &value);
     virtual ze_result_t readValue(const std::string key, uint64_t &value);
+    virtual ze_result_t readSnapshot(const std::vector<TelemetryKey> &keys, TelemetrySnapshot &snapshot);
+    template <typename T>
+    ze_result_t readValueFromSnapshot(const TelemetrySnapshot &snapshot, const std::string key, T &value) const;
     static ze_result_t enumerateRootTelemIndex(FsAccess *pFsAccess, std::string &rootPciPathOfGpuDevice);
     static void create(const std::vector<ze_device_handle_t> &deviceHandles,
                        FsAccess *pFsAccess, std::string &rootPciPathOfGpuDevice,
@@ -40,6 +57,11 @@ class PlatformMonitoringTech : NEO::NonCopyableOrMovableClass {
     ze_result_t init(FsAccess *pFsAccess, const std::string &rootPciPathOfGpuDevice);
     static void doInitPmtObject(FsAccess *pFsAccess, uint32_t subdeviceId, PlatformMonitoringTech *pPmt, const std::string &rootPciPathOfGpuDevice,
                                 std::map<uint32_t, L0::PlatformMonitoringTech *> &mapOfSubDeviceIdToPmtObject);
+    ze_result_t readTelemetry(void *data, size_t size, uint64_t offset);
+    ze_result_t readTelemetry(void *data, size_t size, uint64_t offset, size_t &bytesRead);
+    void closeTelemetryDevice();
+    int telemetryFd = -1;
+    std::mutex telemetryFdMutex;
     decltype(&NEO::SysCalls::open) openFunction = NEO::SysCalls::open;
     decltype(&NEO::SysCalls::close) closeFunction = NEO::SysCalls::close;
     decltype(&NEO::SysCalls::pread) preadFunction = NEO::SysCalls::pread;
@@ -52,4 +74,21 @@ class PlatformMonitoringTech : NEO::NonCopyableOrMovableClass {
     ze_bool_t isSubdevice = 0;
 };
 
+template <typename T>
+ze_result_t PlatformMonitoringTech::readValueFromSnapshot(const TelemetrySnapshot &snapshot, const std::string key, T &value) const {
+    auto offset = keyOffsetMap.find(key);
+    if (offset == keyOffsetMap.end()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    if ((offset->second < snapshot.startOffset) || (offset->second + sizeof(T) > snapshot.endOffset)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (offset->second - snapshot.startOffset + sizeof(T) > snapshot.data.size()) {
+        // key was requested but the telemetry read was truncated before it
+        return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+    }
+    memcpy_s(&value, sizeof(T), snapshot.data.data() + (offset->second - snapshot.startOffset), sizeof(T));
+    return ZE_RESULT_SUCCESS;
+}
+
 } // namespace L0
@@ -13,15 +13,23 @@
 
 namespace L0 {
 
-PowerHandleContext::~PowerHandleContext() {
+void PowerHandleContext::releasePowerHandles() {
     for (Power *pPower : handleList) {
         delete pPower;
     }
+    handleList.clear();
+}
+
+PowerHandleContext::~PowerHandleContext() {
+    releasePowerHandles();
 }
 
 void PowerHandleContext::createHandle(ze_device_handle_t deviceHandle) {
-    Power *pPower = new PowerImp(pOsSysman, deviceHandle);
+    auto pPower = new PowerImp(pOsSysman, deviceHandle);
     if (pPower->initSuccess == true) {
+        if (nullptr != pTelemetrySampler) {
+            pPower->enableTelemetrySampling(*pTelemetrySampler);
+        }
         handleList.push_back(pPower);
     } else {
         delete pPower;
@@ -22,6 +22,7 @@ struct _zes_pwr_handle_t {
 namespace L0 {
 
 struct OsSysman;
+class TelemetrySampler;
 class Power : _zet_sysman_pwr_handle_t, _zes_pwr_handle_t {
   public:
     virtual ze_result_t powerGetProperties(zes_power_properties_t *pProperties) = 0;
@@ -43,9 +44,11 @@ struct PowerHandleContext {
     ~PowerHandleContext();
 
     ze_result_t init(std::vector<ze_device_handle_t> &deviceHandles, ze_device_handle_t coreDevice);
+    void releasePowerHandles();
     ze_result_t powerGet(uint32_t *pCount, zes_pwr_handle_t *phPower);
 
     OsSysman *pOsSysman = nullptr;
+    TelemetrySampler *pTelemetrySampler = nullptr;
     std::vector<Power *> handleList = {};
 
   private:
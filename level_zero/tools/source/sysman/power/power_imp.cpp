@@ -17,6 +17,9 @@ ze_result_t PowerImp::powerGetProperties(zes_power_properties_t *pProperties) {
 }
 
 ze_result_t PowerImp::powerGetEnergyCounter(zes_power_energy_counter_t *pEnergy) {
+    if ((nullptr != pEnergyCounterChannel) && pEnergyCounterChannel->readLatest(*pEnergy)) {
+        return ZE_RESULT_SUCCESS;
+    }
     return pOsPower->getEnergyCounter(pEnergy);
 }
 
@@ -50,7 +53,17 @@ void PowerImp::init() {
     }
 }
 
+void PowerImp::enableTelemetrySampling(TelemetrySampler &sampler) {
+    pTelemetrySampler = &sampler;
+    pEnergyCounterChannel = sampler.addChannel<zes_power_energy_counter_t>([this](zes_power_energy_counter_t &energy) {
+        return pOsPower->getEnergyCounter(&energy);
+    });
+}
+
 PowerImp::~PowerImp() {
+    if (nullptr != pTelemetrySampler) {
+        pTelemetrySampler->removeChannel(pEnergyCounterChannel);
+    }
     if (nullptr != pOsPower) {
         delete pOsPower;
         pOsPower = nullptr;
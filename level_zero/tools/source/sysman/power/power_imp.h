@@ -11,6 +11,7 @@
 
 #include "level_zero/tools/source/sysman/power/os_power.h"
 #include "level_zero/tools/source/sysman/power/power.h"
+#include "level_zero/tools/source/sysman/telemetry_sampler.h"
 #include <level_zero/zet_api.h>
 namespace L0 {
 class PowerImp : public Power, NEO::NonCopyableOrMovableClass {
@@ -28,8 +29,11 @@ class PowerImp : public Power, NEO::NonCopyableOrMovableClass {
 
     OsPower *pOsPower = nullptr;
     void init();
+    void enableTelemetrySampling(TelemetrySampler &sampler);
 
   private:
     ze_device_handle_t deviceHandle = {};
+    TelemetrySampler *pTelemetrySampler = nullptr;
+    TelemetryChannel<zes_power_energy_counter_t> *pEnergyCounterChannel = nullptr;
 };
 } // namespace L0
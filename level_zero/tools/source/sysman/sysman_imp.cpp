@@ -41,6 +41,9 @@ SysmanDeviceImp::SysmanDeviceImp(ze_device_handle_t hDevice) {
 }
 
 SysmanDeviceImp::~SysmanDeviceImp() {
+    if (pTelemetrySampler) {
+        pTelemetrySampler->stop();
+    }
     freeResource(pPerformanceHandleContext);
     freeResource(pDiagnosticsHandleContext);
     freeResource(pFirmwareHandleContext);
@@ -57,6 +60,7 @@ SysmanDeviceImp::~SysmanDeviceImp() {
     freeResource(pPci);
     freeResource(pFrequencyHandleContext);
     freeResource(pPowerHandleContext);
+    freeResource(pTelemetrySampler);
     freeResource(pOsSysman);
 }
 
@@ -80,6 +84,7 @@ ze_result_t SysmanDeviceImp::init() {
     if (ZE_RESULT_SUCCESS != result) {
         return result;
     }
+    setupTelemetrySampler();
     if (pPowerHandleContext) {
         pPowerHandleContext->init(deviceHandles, hCoreDevice);
     }
@@ -128,9 +133,31 @@ ze_result_t SysmanDeviceImp::init() {
     if (pPerformanceHandleContext) {
         pPerformanceHandleContext->init(deviceHandles, hCoreDevice);
     }
+    if (pTelemetrySampler) {
+        pTelemetrySampler->start();
+    }
     return result;
 }
 
+void SysmanDeviceImp::setupTelemetrySampler() {
+    pTelemetrySampler = TelemetrySampler::create();
+    if (nullptr == pTelemetrySampler) {
+        return;
+    }
+    if (pPowerHandleContext) {
+        pPowerHandleContext->pTelemetrySampler = pTelemetrySampler;
+    }
+    if (pFrequencyHandleContext) {
+        pFrequencyHandleContext->pTelemetrySampler = pTelemetrySampler;
+    }
+    if (pTempHandleContext) {
+        pTempHandleContext->pTelemetrySampler = pTelemetrySampler;
+    }
+    if (pEngineHandleContext) {
+        pEngineHandleContext->pTelemetrySampler = pTelemetrySampler;
+    }
+}
+
 ze_result_t SysmanDeviceImp::frequencyGet(uint32_t *pCount, zes_freq_handle_t *phFrequency) {
     return pFrequencyHandleContext->frequencyGet(pCount, phFrequency);
 }
@@ -10,6 +10,7 @@
 
 #include "level_zero/tools/source/sysman/os_sysman.h"
 #include "level_zero/tools/source/sysman/sysman.h"
+#include "level_zero/tools/source/sysman/telemetry_sampler.h"
 #include <level_zero/zes_api.h>
 
 #include <unordered_map>
@@ -43,6 +44,7 @@ struct SysmanDeviceImp : SysmanDevice, NEO::NonCopyableOrMovableClass {
     FirmwareHandleContext *pFirmwareHandleContext = nullptr;
     DiagnosticsHandleContext *pDiagnosticsHandleContext = nullptr;
     PerformanceHandleContext *pPerformanceHandleContext = nullptr;
+    TelemetrySampler *pTelemetrySampler = nullptr;
 
     ze_result_t performanceGet(uint32_t *pCount, zes_perf_handle_t *phPerformance) override;
     ze_result_t powerGet(uint32_t *pCount, zes_pwr_handle_t *phPower) override;
@@ -69,6 +71,7 @@ struct SysmanDeviceImp : SysmanDevice, NEO::NonCopyableOrMovableClass {
     bool deviceEventListen(zes_event_type_flags_t &pEvent, uint64_t timeout) override;
 
     void updateSubDeviceHandlesLocally();
+    void setupTelemetrySampler();
 
   private:
     template <typename T>
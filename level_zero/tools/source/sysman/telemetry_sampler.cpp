@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/tools/source/sysman/telemetry_sampler.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+
+namespace L0 {
+
+TelemetrySampler *TelemetrySampler::create() {
+    if (NEO::DebugManager.flags.SysmanTelemetrySamplingInterval.get() <= 0) {
+        return nullptr;
+    }
+    return new TelemetrySampler(std::chrono::milliseconds(NEO::DebugManager.flags.SysmanTelemetrySamplingInterval.get()));
+}
+
+TelemetrySampler::TelemetrySampler(std::chrono::milliseconds samplingInterval) : samplingInterval(samplingInterval) {
+}
+
+TelemetrySampler::~TelemetrySampler() {
+    stop();
+}
+
+void TelemetrySampler::removeChannel(TelemetryChannelBase *channel) {
+    std::lock_guard<std::mutex> lock(channelsMutex);
+    auto it = std::find_if(channels.begin(), channels.end(), [channel](const auto &entry) { return entry.get() == channel; });
+    if (it != channels.end()) {
+        channels.erase(it);
+    }
+}
+
+void TelemetrySampler::start() {
+    std::lock_guard<std::mutex> lock(samplingMutex);
+    if (thread) {
+        return;
+    }
+    keepSampling = true;
+    thread = NEO::Thread::create(samplingThread, reinterpret_cast<void *>(this));
+}
+
+void TelemetrySampler::stop() {
+    {
+        std::lock_guard<std::mutex> lock(samplingMutex);
+        keepSampling = false;
+    }
+    samplingCondition.notify_all();
+    if (thread) {
+        thread->join();
+        thread.reset();
+    }
+}
+
+void TelemetrySampler::sampleAll() {
+    std::lock_guard<std::mutex> lock(channelsMutex);
+    for (auto &channel : channels) {
+        channel->sample();
+    }
+}
+
+void *TelemetrySampler::samplingThread(void *self) {
+    auto sampler = reinterpret_cast<TelemetrySampler *>(self);
+    std::unique_lock<std::mutex> lock(sampler->samplingMutex);
+    while (!sampler->samplingCondition.wait_for(lock, sampler->samplingInterval, [sampler] { return !sampler->keepSampling; })) {
+        lock.unlock();
+        sampler->sampleAll();
+        lock.lock();
+    }
+    return nullptr;
+}
+
+} // namespace L0
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <level_zero/zes_api.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace NEO {
+class Thread;
+} // namespace NEO
+
+namespace L0 {
+
+class TelemetryChannelBase {
+  public:
+    virtual ~TelemetryChannelBase() = default;
+    virtual void sample() = 0;
+};
+
+// Single writer (the sampler thread), any number of readers.
+// Every slot is guarded by a sequence number, readers retry when the writer overtook them.
+template <typename T>
+class TelemetryChannel : public TelemetryChannelBase, NEO::NonCopyableOrMovableClass {
+    static_assert(std::is_trivially_copyable<T>::value, "telemetry samples are copied without locks");
+
+  public:
+    using SampleFunction = std::function<ze_result_t(T &)>;
+
+    TelemetryChannel(SampleFunction sampleFunction) : sampleFunction(std::move(sampleFunction)) {}
+
+    void sample() override {
+        T value = {};
+        if (ZE_RESULT_SUCCESS == sampleFunction(value)) {
+            publish(value);
+        }
+    }
+
+    void publish(const T &value) {
+        auto index = writeCount.load(std::memory_order_relaxed);
+        auto &slot = slots[index % ringSize];
+        slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.value = value;
+        slot.sequence.store(2 * index + 2, std::memory_order_release);
+        writeCount.store(index + 1, std::memory_order_release);
+    }
+
+    bool readLatest(T &value) const {
+        while (true) {
+            auto count = writeCount.load(std::memory_order_acquire);
+            if (0 == count) {
+                return false;
+            }
+            auto &slot = slots[(count - 1) % ringSize];
+            auto sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence != 2 * count) {
+                continue;
+            }
+            value = slot.value;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) == sequence) {
+                return true;
+            }
+        }
+    }
+
+  protected:
+    static constexpr uint64_t ringSize = 8;
+
+    struct Slot {
+        std::atomic<uint64_t> sequence{0};
+        T value = {};
+    };
+
+    SampleFunction sampleFunction;
+    std::array<Slot, ringSize> slots;
+    std::atomic<uint64_t> writeCount{0};
+};
+
+class TelemetrySampler : NEO::NonCopyableOrMovableClass {
+  public:
+    TelemetrySampler(std::chrono::milliseconds samplingInterval);
+    MOCKABLE_VIRTUAL ~TelemetrySampler();
+
+    static TelemetrySampler *create();
+
+    template <typename T>
+    TelemetryChannel<T> *addChannel(typename TelemetryChannel<T>::SampleFunction sampleFunction) {
+        auto channel = new TelemetryChannel<T>(std::move(sampleFunction));
+        // Sample once up front, so queries following handle creation are already served from the channel
+        channel->sample();
+        std::lock_guard<std::mutex> lock(channelsMutex);
+        channels.emplace_back(channel);
+        return channel;
+    }
+    void removeChannel(TelemetryChannelBase *channel);
+
+    void start();
+    void stop();
+    void sampleAll();
+
+  protected:
+    static void *samplingThread(void *self);
+
+    std::chrono::milliseconds samplingInterval;
+    std::vector<std::unique_ptr<TelemetryChannelBase>> channels;
+    std::mutex channelsMutex;
+
+    std::unique_ptr<NEO::Thread> thread;
+    bool keepSampling = false;
+    std::mutex samplingMutex;
+    std::condition_variable samplingCondition;
+};
+
+} // namespace L0
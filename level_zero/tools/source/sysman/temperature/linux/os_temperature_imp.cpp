@@ -51,9 +51,18 @@ ze_result_t LinuxTemperatureImp::getGlobalMaxTemperatureNoSubDevice(double *pTem
         return maxTemperature;
     };
 
+    // All temperature keys are decoded from one telemetry read
+    TelemetrySnapshot snapshot;
+    ze_result_t result = pPmt->readSnapshot({{"COMPUTE_TEMPERATURES", sizeof(uint32_t)},
+                                            {"CORE_TEMPERATURES", sizeof(uint32_t)},
+                                            {"SOC_TEMPERATURES", sizeof(uint64_t)}},
+                                           snapshot);
+    if (result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
+
     uint32_t computeTemperature = 0;
-    std::string key("COMPUTE_TEMPERATURES");
-    ze_result_t result = pPmt->readValue(key, computeTemperature);
+    result = pPmt->readValueFromSnapshot(snapshot, "COMPUTE_TEMPERATURES", computeTemperature);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
@@ -61,8 +70,7 @@ ze_result_t LinuxTemperatureImp::getGlobalMaxTemperatureNoSubDevice(double *pTem
     uint32_t maxComputeTemperature = getMaxTemperature(computeTemperature, numComputeTemperatureEntries);
 
     uint32_t coreTemperature = 0;
-    key = "CORE_TEMPERATURES";
-    result = pPmt->readValue(key, coreTemperature);
+    result = pPmt->readValueFromSnapshot(snapshot, "CORE_TEMPERATURES", coreTemperature);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
@@ -70,8 +78,7 @@ ze_result_t LinuxTemperatureImp::getGlobalMaxTemperatureNoSubDevice(double *pTem
     uint32_t maxCoreTemperature = getMaxTemperature(coreTemperature, numCoreTemperatureEntries);
 
     uint64_t socTemperature = 0;
-    key = "SOC_TEMPERATURES";
-    result = pPmt->readValue(key, socTemperature);
+    result = pPmt->readValueFromSnapshot(snapshot, "SOC_TEMPERATURES", socTemperature);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
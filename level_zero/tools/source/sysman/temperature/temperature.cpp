@@ -11,15 +11,23 @@
 
 namespace L0 {
 
-TemperatureHandleContext::~TemperatureHandleContext() {
+void TemperatureHandleContext::releaseTemperatureHandles() {
     for (Temperature *pTemperature : handleList) {
         delete pTemperature;
     }
+    handleList.clear();
+}
+
+TemperatureHandleContext::~TemperatureHandleContext() {
+    releaseTemperatureHandles();
 }
 
 void TemperatureHandleContext::createHandle(const ze_device_handle_t &deviceHandle, zes_temp_sensors_t type) {
-    Temperature *pTemperature = new TemperatureImp(deviceHandle, pOsSysman, type);
+    auto pTemperature = new TemperatureImp(deviceHandle, pOsSysman, type);
     if (pTemperature->initSuccess == true) {
+        if (nullptr != pTelemetrySampler) {
+            pTemperature->enableTelemetrySampling(*pTelemetrySampler);
+        }
         handleList.push_back(pTemperature);
     } else {
         delete pTemperature;
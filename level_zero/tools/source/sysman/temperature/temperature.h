@@ -17,6 +17,7 @@ struct _zes_temp_handle_t {
 namespace L0 {
 
 struct OsSysman;
+class TelemetrySampler;
 class Temperature : _zes_temp_handle_t {
   public:
     virtual ze_result_t temperatureGetProperties(zes_temp_properties_t *pProperties) = 0;
@@ -37,10 +38,12 @@ struct TemperatureHandleContext {
     ~TemperatureHandleContext();
 
     void init(std::vector<ze_device_handle_t> &deviceHandles);
+    void releaseTemperatureHandles();
 
     ze_result_t temperatureGet(uint32_t *pCount, zes_temp_handle_t *phTemperature);
 
     OsSysman *pOsSysman = nullptr;
+    TelemetrySampler *pTelemetrySampler = nullptr;
     std::vector<Temperature *> handleList = {};
 
   private:
@@ -25,6 +25,9 @@ ze_result_t TemperatureImp::temperatureSetConfig(const zes_temp_config_t *pConfi
 }
 
 ze_result_t TemperatureImp::temperatureGetState(double *pTemperature) {
+    if ((nullptr != pTemperatureChannel) && pTemperatureChannel->readLatest(*pTemperature)) {
+        return ZE_RESULT_SUCCESS;
+    }
     return pOsTemperature->getSensorTemperature(pTemperature);
 }
 
@@ -43,7 +46,17 @@ TemperatureImp::TemperatureImp(const ze_device_handle_t &deviceHandle, OsSysman
     init();
 }
 
+void TemperatureImp::enableTelemetrySampling(TelemetrySampler &sampler) {
+    pTelemetrySampler = &sampler;
+    pTemperatureChannel = sampler.addChannel<double>([this](double &temperature) {
+        return pOsTemperature->getSensorTemperature(&temperature);
+    });
+}
+
 TemperatureImp::~TemperatureImp() {
+    if (nullptr != pTelemetrySampler) {
+        pTelemetrySampler->removeChannel(pTemperatureChannel);
+    }
 }
 
 } // namespace L0
\ No newline at end of file
@@ -9,6 +9,7 @@
 
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 
+#include "level_zero/tools/source/sysman/telemetry_sampler.h"
 #include "level_zero/tools/source/sysman/temperature/os_temperature.h"
 #include "level_zero/tools/source/sysman/temperature/temperature.h"
 namespace L0 {
@@ -25,5 +26,10 @@ class TemperatureImp : public Temperature, NEO::NonCopyableOrMovableClass {
 
     std::unique_ptr<OsTemperature> pOsTemperature = nullptr;
     void init();
+    void enableTelemetrySampling(TelemetrySampler &sampler);
+
+  private:
+    TelemetrySampler *pTelemetrySampler = nullptr;
+    TelemetryChannel<double> *pTemperatureChannel = nullptr;
 };
 } // namespace L0
@@ -88,6 +88,15 @@ struct Mock<MockPmuInterfaceImp> : public MockPmuInterfaceImp {
     int mockedPmuReadAndFailureReturn(int fd, uint64_t *data, ssize_t sizeOfdata) {
         return -1;
     }
+    int mockedPmuReadGroupAndSuccessReturn(int fd, uint64_t *data, ssize_t sizeOfdata) {
+        uint64_t counterCount = static_cast<uint64_t>(sizeOfdata) / sizeof(uint64_t) - 2;
+        data[0] = counterCount;
+        data[1] = mockTimestamp;
+        for (uint64_t counter = 0; counter < counterCount; counter++) {
+            data[2 + counter] = mockActiveTime + counter * microSecondsToNanoSeconds;
+        }
+        return 0;
+    }
 
     MOCK_METHOD(int64_t, perfEventOpen, (perf_event_attr * attr, pid_t pid, int cpu, int groupFd, uint64_t flags), (override));
     MOCK_METHOD(int, pmuRead, (int fd, uint64_t *data, ssize_t sizeOfdata), (override));
@@ -9,6 +9,8 @@
 
 #include "mock_engine.h"
 
+#include <thread>
+
 extern bool sysmanUltsEnable;
 
 using ::testing::Matcher;
@@ -215,6 +217,106 @@ TEST_F(ZesEngineFixture, GivenValidEngineHandleWhenCallingZesEngineGetActivityAn
     EXPECT_EQ(-1, pPmuInterface->pmuInterfaceOpen(0, -1, 0));
 }
 
+TEST_F(ZesEngineFixture, GivenValidEngineHandlesWhenGettingActivityOfEachEngineInTurnThenAllStatsAreReturnedFromSingleGroupRead) {
+    pSysmanDeviceImp->pEngineHandleContext->groupedSampleValidity = std::chrono::hours(1);
+    EXPECT_CALL(*pPmuInterface.get(), pmuRead(_, _, _))
+        .Times(2)
+        .WillRepeatedly(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImp>::mockedPmuReadGroupAndSuccessReturn));
+
+    auto handles = getEngineHandles(handleComponentCount);
+    for (uint32_t i = 0; i < handleComponentCount; i++) {
+        zes_engine_stats_t stats = {};
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zesEngineGetActivity(handles[i], &stats));
+        EXPECT_EQ(mockActiveTime / microSecondsToNanoSeconds + i, stats.activeTime);
+        EXPECT_EQ(mockTimestamp / microSecondsToNanoSeconds, stats.timestamp);
+    }
+    EXPECT_NE(nullptr, pSysmanDeviceImp->pEngineHandleContext->pOsEngineGroup);
+
+    // engine asking again for its activity gets a new group read
+    zes_engine_stats_t stats = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesEngineGetActivity(handles[0], &stats));
+}
+
+TEST_F(ZesEngineFixture, GivenActivityIsReadFromEngineGroupWhenGettingActivityOfEachEngineThenEngineCountersAreNotOpenedSeparately) {
+    EXPECT_CALL(*pPmuInterface.get(), perfEventOpen(_, _, _, _, _))
+        .Times(handleComponentCount)
+        .WillRepeatedly(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImp>::mockedPerfEventOpenAndSuccessReturn));
+    ON_CALL(*pPmuInterface.get(), pmuRead(_, _, _))
+        .WillByDefault(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImp>::mockedPmuReadGroupAndSuccessReturn));
+
+    auto handles = getEngineHandles(handleComponentCount);
+    for (auto handle : handles) {
+        zes_engine_stats_t stats = {};
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zesEngineGetActivity(handle, &stats));
+    }
+    EXPECT_NE(nullptr, pSysmanDeviceImp->pEngineHandleContext->pOsEngineGroup);
+}
+
+TEST_F(ZesEngineFixture, GivenGroupedSampleIsOutdatedWhenGettingActivityOfNextEngineThenGroupIsReadAgain) {
+    pSysmanDeviceImp->pEngineHandleContext->groupedSampleValidity = std::chrono::microseconds(0);
+    EXPECT_CALL(*pPmuInterface.get(), pmuRead(_, _, _))
+        .Times(2)
+        .WillRepeatedly(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImp>::mockedPmuReadGroupAndSuccessReturn));
+
+    auto handles = getEngineHandles(handleComponentCount);
+    zes_engine_stats_t stats = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesEngineGetActivity(handles[0], &stats));
+    std::this_thread::sleep_for(std::chrono::microseconds(1));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesEngineGetActivity(handles[1], &stats));
+}
+
+TEST_F(ZesEngineFixture, GivenPerfEventGroupCannotBeOpenedWhenGettingActivityOfEngineThenEngineCounterIsReadSeparately) {
+    ON_CALL(*pPmuInterface.get(), perfEventOpen(_, _, _, _, _))
+        .WillByDefault(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImp>::mockedPerfEventOpenAndFailureReturn));
+    EXPECT_CALL(*pPmuInterface.get(), pmuRead(_, _, _))
+        .Times(handleComponentCount)
+        .WillRepeatedly(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImp>::mockedPmuReadAndSuccessReturn));
+
+    auto handles = getEngineHandles(handleComponentCount);
+    for (auto handle : handles) {
+        zes_engine_stats_t stats = {};
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zesEngineGetActivity(handle, &stats));
+        EXPECT_EQ(mockActiveTime / microSecondsToNanoSeconds, stats.activeTime);
+        EXPECT_EQ(mockTimestamp / microSecondsToNanoSeconds, stats.timestamp);
+    }
+    EXPECT_EQ(nullptr, pSysmanDeviceImp->pEngineHandleContext->pOsEngineGroup);
+}
+
+TEST_F(ZesEngineFixture, GivenGroupReadFailsWhenGettingActivityOfEngineThenEngineCounterIsReadAndGroupIsReleased) {
+    EXPECT_CALL(*pPmuInterface.get(), pmuRead(_, _, _))
+        .Times(1 + handleComponentCount)
+        .WillOnce(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImp>::mockedPmuReadAndFailureReturn))
+        .WillRepeatedly(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImp>::mockedPmuReadAndSuccessReturn));
+
+    auto handles = getEngineHandles(handleComponentCount);
+    for (auto handle : handles) {
+        zes_engine_stats_t stats = {};
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zesEngineGetActivity(handle, &stats));
+        EXPECT_EQ(mockActiveTime / microSecondsToNanoSeconds, stats.activeTime);
+    }
+    EXPECT_EQ(nullptr, pSysmanDeviceImp->pEngineHandleContext->pOsEngineGroup);
+}
+
+TEST_F(ZesEngineFixture, GivenMultipleThreadsWhenGettingActivityOfEnginesConcurrentlyThenEngineGroupIsCreatedOnce) {
+    ON_CALL(*pPmuInterface.get(), pmuRead(_, _, _))
+        .WillByDefault(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImp>::mockedPmuReadGroupAndSuccessReturn));
+
+    auto handles = getEngineHandles(handleComponentCount);
+    std::vector<std::thread> threads;
+    for (auto handle : handles) {
+        threads.emplace_back([handle] {
+            zes_engine_stats_t stats = {};
+            for (uint32_t i = 0; i < 10; i++) {
+                EXPECT_EQ(ZE_RESULT_SUCCESS, zesEngineGetActivity(handle, &stats));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_NE(nullptr, pSysmanDeviceImp->pEngineHandleContext->pOsEngineGroup);
+}
+
 TEST_F(ZesEngineFixture, GivenValidOsSysmanPointerWhenRetrievingEngineTypeAndInstancesAndIfEngineInfoQueryFailsThenErrorIsReturned) {
     std::set<std::pair<zes_engine_group_t, EngineInstanceSubDeviceId>> engineGroupInstance;
     ON_CALL(*pDrm.get(), sysmanQueryEngineInfo())
@@ -452,6 +452,8 @@ struct Mock<FirmwareInterface> : public FirmwareUtil {
 
 class PublicLinuxGlobalOperationsImp : public L0::LinuxGlobalOperationsImp {
   public:
+    using LinuxGlobalOperationsImp::maxProcessScanThreads;
+    using LinuxGlobalOperationsImp::minProcessesPerScanThread;
     using LinuxGlobalOperationsImp::resetTimeout;
 };
 
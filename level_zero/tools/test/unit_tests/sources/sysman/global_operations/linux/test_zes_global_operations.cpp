@@ -267,6 +267,33 @@ TEST_F(SysmanGlobalOperationsFixture, GivenValidDeviceHandleWhileRetrievingInfor
     EXPECT_EQ(processes[4].sharedSize, sharedMemSize7);
 }
 
+TEST_F(SysmanGlobalOperationsFixture, GivenClientScanSplitAcrossThreadsWhileRetrievingInformationAboutHostProcessesUsingDeviceThenResultsMatchSequentialScan) {
+    auto pLinuxGlobalOperationsImp = static_cast<PublicLinuxGlobalOperationsImp *>(pGlobalOperationsImp->pOsGlobalOperations);
+    pLinuxGlobalOperationsImp->maxProcessScanThreads = 4;
+    pLinuxGlobalOperationsImp->minProcessesPerScanThread = 1;
+
+    uint32_t count = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, nullptr));
+    EXPECT_EQ(count, totalProcessStates);
+    std::vector<zes_process_state_t> processes(count);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zesDeviceProcessesGetState(device, &count, processes.data()));
+    EXPECT_EQ(processes[0].processId, pid1);
+    EXPECT_EQ(processes[0].engines, engines1);
+    EXPECT_EQ(processes[0].memSize, memSize1);
+    EXPECT_EQ(processes[1].processId, pid2);
+    EXPECT_EQ(processes[1].engines, engines2);
+    EXPECT_EQ(processes[1].memSize, memSize2);
+    EXPECT_EQ(processes[2].processId, pid4);
+    EXPECT_EQ(processes[2].engines, engines4);
+    EXPECT_EQ(processes[2].memSize, memSize4);
+    EXPECT_EQ(processes[3].processId, pid6);
+    EXPECT_EQ(processes[3].engines, engines6);
+    EXPECT_EQ(processes[3].memSize, memSize6);
+    EXPECT_EQ(processes[4].processId, pid7);
+    EXPECT_EQ(processes[4].engines, engines7);
+    EXPECT_EQ(processes[4].memSize, memSize7);
+}
+
 TEST_F(SysmanGlobalOperationsFixture, GivenValidDeviceHandleWhileRetrievingInformationAboutHostProcessesUsingDeviceThenSuccessIsReturnedEvenwithFaultyClient) {
     uint32_t count = 0;
     ON_CALL(*pSysfsAccess.get(), scanDirEntries(_, _))
@@ -424,6 +451,33 @@ TEST_F(SysmanGlobalOperationsFixture, GivenDeviceNotInUseWhenCallingResetThenSuc
     EXPECT_EQ(errno, EBADF);
 }
 
+TEST_F(SysmanGlobalOperationsFixture, GivenTelemetrySamplingEnabledWhenCallingResetThenSamplerIsStoppedWhileHandlesAreRecreatedAndStartedAgainAfterwards) {
+    struct PublicTelemetrySampler : public TelemetrySampler {
+        using TelemetrySampler::TelemetrySampler;
+        using TelemetrySampler::thread;
+    };
+    // Sampler is released together with the sysman device
+    auto pSampler = new PublicTelemetrySampler(std::chrono::milliseconds(1));
+    pSysmanDeviceImp->pTelemetrySampler = pSampler;
+    pSysmanDeviceImp->pTempHandleContext->pTelemetrySampler = pSampler;
+    pSysmanDeviceImp->pPowerHandleContext->pTelemetrySampler = pSampler;
+    pSampler->start();
+    ASSERT_NE(nullptr, pSampler->thread);
+
+    pProcfsAccess->ourDevicePid = getpid();
+    pProcfsAccess->ourDeviceFd = ::open("/dev/null", 0);
+    EXPECT_CALL(*pProcfsAccess.get(), listProcesses(Matcher<std::vector<::pid_t> &>(_)))
+        .WillOnce(::testing::Invoke(pProcfsAccess.get(), &Mock<GlobalOperationsProcfsAccess>::mockProcessListDeviceInUse))
+        .WillRepeatedly(::testing::Invoke(pProcfsAccess.get(), &Mock<GlobalOperationsProcfsAccess>::mockProcessListDeviceUnused));
+    EXPECT_CALL(*pSysfsAccess.get(), bindDevice(_))
+        .WillOnce(::testing::Return(ZE_RESULT_SUCCESS));
+    EXPECT_CALL(*pEngineHandleContext.get(), init())
+        .WillOnce(::testing::Invoke([pSampler]() { EXPECT_EQ(nullptr, pSampler->thread); }));
+    pGlobalOperationsImp->init();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesDeviceReset(device, false));
+    EXPECT_NE(nullptr, pSampler->thread);
+}
+
 TEST_F(SysmanGlobalOperationsFixture, GivenForceTrueAndDeviceInUseWhenCallingResetThenSuccessIsReturned) {
     // Pretend another process has the device open
     pProcfsAccess->ourDevicePid = getpid() + 1; // make sure it isn't our process id
@@ -440,6 +494,30 @@ TEST_F(SysmanGlobalOperationsFixture, GivenForceTrueAndDeviceInUseWhenCallingRes
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+TEST_F(SysmanGlobalOperationsFixture, GivenManyProcessesAndScanSplitAcrossThreadsWhenCallingResetWithForceThenOnlyProcessUsingDeviceIsKilled) {
+    auto pLinuxGlobalOperationsImp = static_cast<PublicLinuxGlobalOperationsImp *>(pGlobalOperationsImp->pOsGlobalOperations);
+    pLinuxGlobalOperationsImp->maxProcessScanThreads = 4;
+    pLinuxGlobalOperationsImp->minProcessesPerScanThread = 1;
+
+    // Pretend one of many other processes has the device open
+    pProcfsAccess->pidList.clear();
+    for (::pid_t pid = 1; pid <= 256; pid++) {
+        pProcfsAccess->pidList.push_back(getpid() + pid);
+    }
+    pProcfsAccess->ourDevicePid = pProcfsAccess->pidList[100];
+    pProcfsAccess->ourDeviceFd = pProcfsAccess->extraFd;
+
+    ON_CALL(*pProcfsAccess.get(), listProcesses(Matcher<std::vector<::pid_t> &>(_)))
+        .WillByDefault(::testing::Invoke(pProcfsAccess.get(), &Mock<GlobalOperationsProcfsAccess>::mockProcessListDeviceUnused));
+    EXPECT_CALL(*pProcfsAccess.get(), kill(pProcfsAccess->ourDevicePid))
+        .WillOnce(::testing::Invoke(pProcfsAccess.get(), &Mock<GlobalOperationsProcfsAccess>::mockKill));
+    EXPECT_CALL(*pSysfsAccess.get(), bindDevice(_))
+        .WillOnce(::testing::Return(ZE_RESULT_SUCCESS));
+    pGlobalOperationsImp->init();
+    ze_result_t result = zesDeviceReset(device, true);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+}
+
 TEST_F(SysmanGlobalOperationsFixture, GivenProcessStartsMidResetWhenCallingResetThenSuccessIsReturned) {
     // Pretend another process has the device open
     pProcfsAccess->ourDevicePid = getpid() + 1; // make sure it isn't our process id
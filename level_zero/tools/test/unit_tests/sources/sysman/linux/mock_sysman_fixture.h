@@ -154,7 +154,13 @@ class SysmanMultiDeviceFixture : public MultiDeviceFixture, public ::testing::Te
 class PublicFsAccess : public L0::FsAccess {
   public:
     using FsAccess::accessSyscall;
+    using FsAccess::closeSyscall;
+    using FsAccess::openSyscall;
+    using FsAccess::preadSyscall;
     using FsAccess::statSyscall;
+    using FsAccess::maxCachedSysfsFds;
+    using FsAccess::sysfsFdCache;
+    using FsAccess::sysfsFdLru;
 };
 
 class PublicSysfsAccess : public L0::SysfsAccess {
@@ -135,6 +135,7 @@ class PublicPlatformMonitoringTech : public L0::PlatformMonitoringTech {
     using PlatformMonitoringTech::openFunction;
     using PlatformMonitoringTech::preadFunction;
     using PlatformMonitoringTech::telemetryDeviceEntry;
+    using PlatformMonitoringTech::telemetryFd;
 };
 
 } // namespace ult
@@ -9,6 +9,8 @@
 
 #include "mock_pmt.h"
 
+#include <fcntl.h>
+
 extern bool sysmanUltsEnable;
 
 using ::testing::_;
@@ -158,10 +160,6 @@ inline static int closeMock(int fd) {
     return -1;
 }
 
-inline static int closeMockReturnFailure(int fd) {
-    return -1;
-}
-
 ssize_t preadMockPmt(int fd, void *buf, size_t count, off_t offset) {
     return count;
 }
@@ -170,6 +168,36 @@ ssize_t preadMockPmtFailure(int fd, void *buf, size_t count, off_t offset) {
     return -1;
 }
 
+static uint32_t openCalled = 0;
+static uint32_t closeCalled = 0;
+static int openFlags = 0;
+
+inline static int openMockCounted(const char *pathname, int flags) {
+    openCalled++;
+    openFlags = flags;
+    return openMock(pathname, flags);
+}
+
+inline static int closeMockCounted(int fd) {
+    closeCalled++;
+    return closeMock(fd);
+}
+
+ssize_t preadMockPmtSnapshot(int fd, void *buf, size_t count, off_t offset) {
+    uint8_t *mockBuf = static_cast<uint8_t *>(buf);
+    for (size_t i = 0; i < count; i++) {
+        mockBuf[i] = static_cast<uint8_t>(offset + i);
+    }
+    return count;
+}
+
+ssize_t preadMockPmtShortRead(int fd, void *buf, size_t count, off_t offset) {
+    // telemetry region ends at offset 0x18
+    auto bytesAvailable = std::min(count, static_cast<size_t>(0x18 - offset));
+    preadMockPmtSnapshot(fd, buf, bytesAvailable, offset);
+    return bytesAvailable;
+}
+
 TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint32TypeAndOpenSysCallFailsThenreadValueFails) {
     auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
     pPmt->openFunction = openMockReturnFailure;
@@ -179,16 +207,26 @@ TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint3
     EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("DUMMY_KEY", val));
 }
 
-TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint32TypeAndCloseSysCallFailsThenreadValueFails) {
+TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint32TypeMultipleTimesThenTelemetryDeviceIsOpenedOnceAndClosedOnDestruction) {
     auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
     pPmt->telemetryDeviceEntry = baseTelemSysFS + "/" + telemNodeForSubdevice0 + "/" + telem;
-    pPmt->openFunction = openMock;
+    pPmt->openFunction = openMockCounted;
     pPmt->preadFunction = preadMockPmt;
-    pPmt->closeFunction = closeMockReturnFailure;
+    pPmt->closeFunction = closeMockCounted;
+    openCalled = 0;
+    closeCalled = 0;
 
     uint32_t val = 0;
     pPmt->keyOffsetMap = dummyKeyOffsetMap;
-    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, pPmt->readValue("DUMMY_KEY", val));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("DUMMY_KEY", val));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("DUMMY_KEY", val));
+    EXPECT_EQ(1u, openCalled);
+    EXPECT_EQ(O_RDONLY | O_CLOEXEC, openFlags);
+    EXPECT_EQ(0u, closeCalled);
+    EXPECT_EQ(fakeFileDescriptor, pPmt->telemetryFd);
+
+    pPmt.reset();
+    EXPECT_EQ(1u, closeCalled);
 }
 
 TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint64TypeAndOpenSysCallFailsThenreadValueFails) {
@@ -200,16 +238,42 @@ TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint6
     EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("DUMMY_KEY", val));
 }
 
-TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint64TypeAndCloseSysCallFailsThenreadValueFails) {
+TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint64TypeMultipleTimesThenTelemetryDeviceIsOpenedOnce) {
     auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
     pPmt->telemetryDeviceEntry = baseTelemSysFS + "/" + telemNodeForSubdevice0 + "/" + telem;
-    pPmt->openFunction = openMock;
+    pPmt->openFunction = openMockCounted;
     pPmt->preadFunction = preadMockPmt;
-    pPmt->closeFunction = closeMockReturnFailure;
+    pPmt->closeFunction = closeMockCounted;
+    openCalled = 0;
+    closeCalled = 0;
 
     uint64_t val = 0;
     pPmt->keyOffsetMap = dummyKeyOffsetMap;
-    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, pPmt->readValue("DUMMY_KEY", val));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("DUMMY_KEY", val));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("DUMMY_KEY", val));
+    EXPECT_EQ(1u, openCalled);
+    EXPECT_EQ(0u, closeCalled);
+}
+
+TEST_F(ZesPmtFixtureMultiDevice, GivenPreadSysCallFailsWhenCallingreadValueThenTelemetryDeviceIsClosedAndReopenedOnNextRead) {
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    pPmt->telemetryDeviceEntry = baseTelemSysFS + "/" + telemNodeForSubdevice0 + "/" + telem;
+    pPmt->openFunction = openMockCounted;
+    pPmt->preadFunction = preadMockPmtFailure;
+    pPmt->closeFunction = closeMockCounted;
+    openCalled = 0;
+    closeCalled = 0;
+
+    uint64_t val = 0;
+    pPmt->keyOffsetMap = dummyKeyOffsetMap;
+    EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("DUMMY_KEY", val));
+    EXPECT_EQ(1u, openCalled);
+    EXPECT_EQ(1u, closeCalled);
+    EXPECT_EQ(-1, pPmt->telemetryFd);
+
+    pPmt->preadFunction = preadMockPmt;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("DUMMY_KEY", val));
+    EXPECT_EQ(2u, openCalled);
 }
 
 TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint32TypeAndPreadSysCallFailsThenreadValueFails) {
@@ -236,6 +300,85 @@ TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint6
     EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("DUMMY_KEY", val));
 }
 
+TEST_F(ZesPmtFixtureMultiDevice, GivenMultipleKeysWhenCallingReadSnapshotThenAllKeysAreDecodedFromSingleRead) {
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    pPmt->telemetryDeviceEntry = baseTelemSysFS + "/" + telemNodeForSubdevice0 + "/" + telem;
+    pPmt->openFunction = openMock;
+    pPmt->preadFunction = preadMockPmtSnapshot;
+    pPmt->closeFunction = closeMock;
+    pPmt->keyOffsetMap = {{"KEY_A", 0x10}, {"KEY_B", 0x20}, {"KEY_C", 0x400}};
+
+    TelemetrySnapshot snapshot;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readSnapshot({{"KEY_B", sizeof(uint64_t)}, {"KEY_A", sizeof(uint32_t)}}, snapshot));
+    EXPECT_EQ(0x10u, snapshot.startOffset);
+    EXPECT_EQ(0x10u + sizeof(uint64_t), snapshot.data.size());
+
+    uint32_t valA = 0;
+    uint64_t valB = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValueFromSnapshot(snapshot, "KEY_A", valA));
+    EXPECT_EQ(0x13121110u, valA);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValueFromSnapshot(snapshot, "KEY_B", valB));
+    EXPECT_EQ(0x2726252423222120u, valB);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, pPmt->readValueFromSnapshot(snapshot, "KEY_C", valB));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, pPmt->readValueFromSnapshot(snapshot, "UNKNOWN_KEY", valB));
+}
+
+TEST_F(ZesPmtFixtureMultiDevice, GivenKeysOfDifferentWidthsWhenCallingReadSnapshotThenOnlyBytesOfRequestedKeysAreRead) {
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    pPmt->telemetryDeviceEntry = baseTelemSysFS + "/" + telemNodeForSubdevice0 + "/" + telem;
+    pPmt->openFunction = openMock;
+    pPmt->preadFunction = preadMockPmtSnapshot;
+    pPmt->closeFunction = closeMock;
+    pPmt->keyOffsetMap = {{"KEY_A", 0x10}, {"KEY_B", 0x20}};
+
+    TelemetrySnapshot snapshot;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readSnapshot({{"KEY_A", sizeof(uint32_t)}, {"KEY_B", sizeof(uint32_t)}}, snapshot));
+    EXPECT_EQ(0x10u, snapshot.startOffset);
+    EXPECT_EQ(0x10u + sizeof(uint32_t), snapshot.data.size());
+
+    uint32_t valB = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValueFromSnapshot(snapshot, "KEY_B", valB));
+    EXPECT_EQ(0x23222120u, valB);
+}
+
+TEST_F(ZesPmtFixtureMultiDevice, GivenShortReadWhenCallingReadSnapshotThenKeysWithinReadBytesAreDecodedAndRemainingKeysAreReported) {
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    pPmt->telemetryDeviceEntry = baseTelemSysFS + "/" + telemNodeForSubdevice0 + "/" + telem;
+    pPmt->openFunction = openMock;
+    pPmt->preadFunction = preadMockPmtShortRead;
+    pPmt->closeFunction = closeMock;
+    pPmt->keyOffsetMap = {{"KEY_A", 0x10}, {"KEY_B", 0x14}};
+
+    TelemetrySnapshot snapshot;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readSnapshot({{"KEY_A", sizeof(uint32_t)}, {"KEY_B", sizeof(uint64_t)}}, snapshot));
+    EXPECT_EQ(0x10u, snapshot.startOffset);
+    EXPECT_EQ(0x8u, snapshot.data.size());
+
+    uint32_t valA = 0;
+    uint64_t valB = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValueFromSnapshot(snapshot, "KEY_A", valA));
+    EXPECT_EQ(0x13121110u, valA);
+    EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValueFromSnapshot(snapshot, "KEY_B", valB));
+
+    EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("KEY_B", valB));
+}
+
+TEST_F(ZesPmtFixtureMultiDevice, GivenInvalidKeysOrFailingPreadWhenCallingReadSnapshotThenErrorIsReturned) {
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    pPmt->telemetryDeviceEntry = baseTelemSysFS + "/" + telemNodeForSubdevice0 + "/" + telem;
+    pPmt->openFunction = openMock;
+    pPmt->preadFunction = preadMockPmtFailure;
+    pPmt->closeFunction = closeMock;
+    pPmt->keyOffsetMap = dummyKeyOffsetMap;
+
+    TelemetrySnapshot snapshot;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, pPmt->readSnapshot({}, snapshot));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, pPmt->readSnapshot({{"DUMMY_KEY", sizeof(uint32_t)}, {"UNKNOWN_KEY", sizeof(uint32_t)}}, snapshot));
+    EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readSnapshot({{"DUMMY_KEY", sizeof(uint32_t)}}, snapshot));
+    EXPECT_TRUE(snapshot.data.empty());
+}
+
 TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenDoingPMTInitThenPMTmapOfSubDeviceIdToPmtObjectWouldContainValidEntries) {
     std::map<uint32_t, L0::PlatformMonitoringTech *> mapOfSubDeviceIdToPmtObject;
     for (const auto &deviceHandle : deviceHandles) {
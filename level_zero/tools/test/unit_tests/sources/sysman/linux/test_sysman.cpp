@@ -5,6 +5,8 @@
  *
  */
 
+#include "shared/source/helpers/string.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/test_macros/test.h"
 
 #include "level_zero/tools/test/unit_tests/sources/sysman/linux/mock_sysman_fixture.h"
@@ -34,6 +36,157 @@ inline static int mockStatNoPermissions(const char *pathname, struct stat *sb) n
     return 0;
 }
 
+constexpr int mockSysfsFd = 0x5f5;
+static uint32_t mockSysfsOpenCalled = 0u;
+static uint32_t mockSysfsCloseCalled = 0u;
+static int mockSysfsOpenFlags = 0;
+static const char *mockSysfsContent = "";
+static bool mockSysfsPreadFailure = false;
+
+inline static int mockSysfsOpen(const char *pathname, int flags) {
+    mockSysfsOpenCalled++;
+    mockSysfsOpenFlags = flags;
+    return mockSysfsFd;
+}
+
+inline static int mockSysfsClose(int fd) {
+    mockSysfsCloseCalled++;
+    return 0;
+}
+
+inline static ssize_t mockSysfsPread(int fd, void *buf, size_t count, off_t offset) {
+    if (mockSysfsPreadFailure) {
+        errno = ENODEV;
+        return -1;
+    }
+    size_t length = std::min(count, strlen(mockSysfsContent));
+    memcpy_s(buf, count, mockSysfsContent, length);
+    return static_cast<ssize_t>(length);
+}
+
+class SysmanFsAccessSysfsFixture : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        mockSysfsOpenCalled = 0u;
+        mockSysfsCloseCalled = 0u;
+        mockSysfsOpenFlags = 0;
+        mockSysfsContent = "";
+        mockSysfsPreadFailure = false;
+        pFsAccess = std::make_unique<PublicFsAccess>();
+        pFsAccess->openSyscall = mockSysfsOpen;
+        pFsAccess->closeSyscall = mockSysfsClose;
+        pFsAccess->preadSyscall = mockSysfsPread;
+    }
+    std::unique_ptr<PublicFsAccess> pFsAccess;
+    const std::string sysfsNode = "/sys/class/drm/card0/gt_cur_freq_mhz";
+};
+
+TEST_F(SysmanFsAccessSysfsFixture, GivenSysfsNodeWhenReadingValuesRepeatedlyThenFileIsOpenedOnceAndClosedOnDestruction) {
+    mockSysfsContent = "1300\n";
+    uint64_t val = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pFsAccess->read(sysfsNode, val));
+    EXPECT_EQ(1300u, val);
+    mockSysfsContent = "1450\n";
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pFsAccess->read(sysfsNode, val));
+    EXPECT_EQ(1450u, val);
+    EXPECT_EQ(1u, mockSysfsOpenCalled);
+    EXPECT_EQ(1u, pFsAccess->sysfsFdCache.size());
+
+    pFsAccess.reset();
+    EXPECT_EQ(1u, mockSysfsCloseCalled);
+}
+
+TEST_F(SysmanFsAccessSysfsFixture, GivenSysfsNodeWhenReadingValueThenNodeIsOpenedReadOnlyWithCloseOnExec) {
+    mockSysfsContent = "1\n";
+    uint64_t val = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pFsAccess->read(sysfsNode, val));
+    EXPECT_EQ(O_RDONLY, mockSysfsOpenFlags & O_ACCMODE);
+    EXPECT_EQ(O_CLOEXEC, mockSysfsOpenFlags & O_CLOEXEC);
+}
+
+TEST_F(SysmanFsAccessSysfsFixture, GivenCachedSysfsNodeInUseWhenItIsDroppedFromCacheThenItIsClosedAfterLastUser) {
+    mockSysfsContent = "1\n";
+    uint64_t val = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pFsAccess->read(sysfsNode, val));
+    auto fdInUse = pFsAccess->sysfsFdCache[sysfsNode];
+
+    mockSysfsPreadFailure = true;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, pFsAccess->read(sysfsNode, val));
+    EXPECT_TRUE(pFsAccess->sysfsFdCache.empty());
+    EXPECT_EQ(1u, mockSysfsCloseCalled);
+
+    fdInUse.reset();
+    EXPECT_EQ(2u, mockSysfsCloseCalled);
+}
+
+TEST_F(SysmanFsAccessSysfsFixture, GivenSysfsNodeWhenReadingDifferentTypesThenValuesAreParsedLikeStreamExtraction) {
+    mockSysfsContent = "  -42 trailing\n";
+    int32_t int32Val = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pFsAccess->read(sysfsNode, int32Val));
+    EXPECT_EQ(-42, int32Val);
+
+    mockSysfsContent = "4000000000\n";
+    uint32_t uint32Val = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pFsAccess->read(sysfsNode, uint32Val));
+    EXPECT_EQ(4000000000u, uint32Val);
+
+    mockSysfsContent = "1.5\n";
+    double doubleVal = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pFsAccess->read(sysfsNode, doubleVal));
+    EXPECT_EQ(1.5, doubleVal);
+
+    mockSysfsContent = "performance other\n";
+    std::string stringVal;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pFsAccess->read(sysfsNode, stringVal));
+    EXPECT_EQ("performance", stringVal);
+}
+
+TEST_F(SysmanFsAccessSysfsFixture, GivenSysfsNodeWithInvalidContentWhenReadingValueThenErrorIsReturned) {
+    uint32_t uint32Val = 0;
+    std::string stringVal;
+    mockSysfsContent = "\n";
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, pFsAccess->read(sysfsNode, uint32Val));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, pFsAccess->read(sysfsNode, stringVal));
+    mockSysfsContent = "5000000000\n";
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, pFsAccess->read(sysfsNode, uint32Val));
+}
+
+TEST_F(SysmanFsAccessSysfsFixture, GivenCachedSysfsNodeWhenPreadFailsThenNodeIsReopened) {
+    mockSysfsContent = "1\n";
+    uint64_t val = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pFsAccess->read(sysfsNode, val));
+
+    mockSysfsPreadFailure = true;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, pFsAccess->read(sysfsNode, val));
+    EXPECT_EQ(2u, mockSysfsOpenCalled);
+    EXPECT_EQ(2u, mockSysfsCloseCalled);
+    EXPECT_TRUE(pFsAccess->sysfsFdCache.empty());
+
+    mockSysfsPreadFailure = false;
+    mockSysfsContent = "2\n";
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pFsAccess->read(sysfsNode, val));
+    EXPECT_EQ(2u, val);
+    EXPECT_EQ(3u, mockSysfsOpenCalled);
+}
+
+TEST_F(SysmanFsAccessSysfsFixture, GivenManyClientNodesWhenReadingThemThenCacheStaysBoundedAndRecentlyReadNodeIsKept) {
+    mockSysfsContent = "1\n";
+    uint64_t val = 0;
+    const uint32_t clientCount = 4 * static_cast<uint32_t>(PublicFsAccess::maxCachedSysfsFds);
+    for (uint32_t clientId = 0; clientId < clientCount; clientId++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, pFsAccess->read(sysfsNode, val));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, pFsAccess->read("/sys/class/drm/card0/clients/" + std::to_string(clientId) + "/pid", val));
+        EXPECT_LE(pFsAccess->sysfsFdCache.size(), PublicFsAccess::maxCachedSysfsFds);
+        EXPECT_EQ(pFsAccess->sysfsFdCache.size(), pFsAccess->sysfsFdLru.size());
+    }
+    EXPECT_EQ(1u, pFsAccess->sysfsFdCache.count(sysfsNode));
+    EXPECT_EQ(clientCount + 1, mockSysfsOpenCalled);
+    EXPECT_EQ(mockSysfsOpenCalled - pFsAccess->sysfsFdCache.size(), mockSysfsCloseCalled);
+
+    pFsAccess.reset();
+    EXPECT_EQ(mockSysfsOpenCalled, mockSysfsCloseCalled);
+}
+
 TEST_F(SysmanDeviceFixture, GivenValidDeviceHandleInSysmanImpCreationWhenAllSysmanInterfacesAreAssignedToNullThenExpectSysmanDeviceModuleContextsAreNull) {
     ze_device_handle_t hSysman = device->toHandle();
     SysmanDeviceImp *sysmanImp = new SysmanDeviceImp(hSysman);
@@ -228,7 +381,7 @@ TEST_F(SysmanDeviceFixture, GivenPublicFsAccessClassWhenCallingCanWriteWithInval
 }
 
 TEST_F(SysmanDeviceFixture, GivenValidPathnameWhenCallingFsAccessExistsThenSuccessIsReturned) {
-    auto FsAccess = pLinuxSysmanImp->getFsAccess();
+    auto &FsAccess = pLinuxSysmanImp->getFsAccess();
 
     char cwd[PATH_MAX];
     std::string path = getcwd(cwd, PATH_MAX);
@@ -236,7 +389,7 @@ TEST_F(SysmanDeviceFixture, GivenValidPathnameWhenCallingFsAccessExistsThenSucce
 }
 
 TEST_F(SysmanDeviceFixture, GivenInvalidPathnameWhenCallingFsAccessExistsThenErrorIsReturned) {
-    auto FsAccess = pLinuxSysmanImp->getFsAccess();
+    auto &FsAccess = pLinuxSysmanImp->getFsAccess();
 
     std::string path = "noSuchFileOrDirectory";
     EXPECT_FALSE(FsAccess.fileExists(path));
@@ -263,13 +416,13 @@ TEST_F(SysmanDeviceFixture, GivenCreateProcfsAccessHandleWhenCallinggetProcfsAcc
 }
 
 TEST_F(SysmanDeviceFixture, GivenValidPidWhenCallingProcfsAccessIsAliveThenSuccessIsReturned) {
-    auto ProcfsAccess = pLinuxSysmanImp->getProcfsAccess();
+    auto &ProcfsAccess = pLinuxSysmanImp->getProcfsAccess();
 
     EXPECT_TRUE(ProcfsAccess.isAlive(getpid()));
 }
 
 TEST_F(SysmanDeviceFixture, GivenInvalidPidWhenCallingProcfsAccessIsAliveThenErrorIsReturned) {
-    auto ProcfsAccess = pLinuxSysmanImp->getProcfsAccess();
+    auto &ProcfsAccess = pLinuxSysmanImp->getProcfsAccess();
 
     EXPECT_FALSE(ProcfsAccess.isAlive(reinterpret_cast<::pid_t>(-1)));
 }
@@ -330,7 +483,7 @@ TEST_F(SysmanMultiDeviceFixture, GivenValidDeviceHandleHavingSubdevicesWhenValid
 
 TEST_F(SysmanMultiDeviceFixture, GivenValidEffectiveUserIdCheckWhetherPermissionsReturnedByIsRootUserAreCorrect) {
     int euid = geteuid();
-    auto pFsAccess = pLinuxSysmanImp->getFsAccess();
+    auto &pFsAccess = pLinuxSysmanImp->getFsAccess();
     if (euid == 0) {
         EXPECT_EQ(true, pFsAccess.isRootUser());
     } else {
@@ -357,6 +510,95 @@ TEST_F(SysmanMultiDeviceFixture, GivenSysmanEnvironmentVariableSetWhenCreateL0De
     EXPECT_EQ(device->getSysmanHandle(), nullptr);
 }
 
+TEST(SysmanTelemetryChannelTest, GivenNoSampleWhenReadingLatestThenFalseIsReturned) {
+    TelemetryChannel<double> channel([](double &value) { return ZE_RESULT_ERROR_NOT_AVAILABLE; });
+    double value = 0.0;
+    EXPECT_FALSE(channel.readLatest(value));
+    channel.sample();
+    EXPECT_FALSE(channel.readLatest(value));
+}
+
+TEST(SysmanTelemetryChannelTest, GivenMoreSamplesThanRingSlotsWhenReadingLatestThenLastSampleIsReturned) {
+    uint64_t sampleCount = 0u;
+    TelemetryChannel<zes_engine_stats_t> channel([&sampleCount](zes_engine_stats_t &stats) {
+        sampleCount++;
+        stats.activeTime = sampleCount;
+        stats.timestamp = sampleCount * 10;
+        return ZE_RESULT_SUCCESS;
+    });
+    for (uint32_t i = 0; i < 20; i++) {
+        channel.sample();
+    }
+    zes_engine_stats_t stats = {};
+    EXPECT_TRUE(channel.readLatest(stats));
+    EXPECT_EQ(20u, stats.activeTime);
+    EXPECT_EQ(200u, stats.timestamp);
+}
+
+TEST(SysmanTelemetrySamplerTest, GivenChannelAddedWhenSamplingThenChannelIsSampledUpFrontAndOnEverySamplingPass) {
+    TelemetrySampler sampler(std::chrono::milliseconds(1000));
+    double currentValue = 1.0;
+    auto channel = sampler.addChannel<double>([&currentValue](double &value) {
+        value = currentValue;
+        return ZE_RESULT_SUCCESS;
+    });
+    double value = 0.0;
+    EXPECT_TRUE(channel->readLatest(value));
+    EXPECT_EQ(1.0, value);
+
+    currentValue = 2.0;
+    sampler.sampleAll();
+    EXPECT_TRUE(channel->readLatest(value));
+    EXPECT_EQ(2.0, value);
+
+    sampler.removeChannel(channel);
+    currentValue = 3.0;
+    sampler.sampleAll();
+}
+
+TEST(SysmanTelemetrySamplerTest, GivenSamplerStartedWhenWaitingThenBackgroundThreadPublishesNewSamples) {
+    TelemetrySampler sampler(std::chrono::milliseconds(1));
+    std::atomic<uint64_t> sampleCount{0u};
+    auto channel = sampler.addChannel<uint64_t>([&sampleCount](uint64_t &value) {
+        value = ++sampleCount;
+        return ZE_RESULT_SUCCESS;
+    });
+    sampler.start();
+    sampler.start();
+    uint64_t value = 0u;
+    while (value < 3u) {
+        EXPECT_TRUE(channel->readLatest(value));
+        std::this_thread::yield();
+    }
+    sampler.stop();
+    auto samplesAfterStop = sampleCount.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_EQ(samplesAfterStop, sampleCount.load());
+}
+
+TEST(SysmanTelemetrySamplerTest, GivenSamplingIntervalDebugFlagWhenCreatingSamplerThenSamplerIsCreatedOnlyWhenIntervalIsPositive) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(nullptr, TelemetrySampler::create());
+
+    NEO::DebugManager.flags.SysmanTelemetrySamplingInterval.set(0);
+    EXPECT_EQ(nullptr, TelemetrySampler::create());
+
+    NEO::DebugManager.flags.SysmanTelemetrySamplingInterval.set(10);
+    std::unique_ptr<TelemetrySampler> sampler(TelemetrySampler::create());
+    EXPECT_NE(nullptr, sampler);
+}
+
+TEST_F(SysmanDeviceFixture, GivenTelemetrySamplingEnabledWhenSettingUpSamplerThenSamplerIsSharedWithSampledHandleContexts) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.SysmanTelemetrySamplingInterval.set(1000);
+    pSysmanDeviceImp->setupTelemetrySampler();
+    ASSERT_NE(nullptr, pSysmanDeviceImp->pTelemetrySampler);
+    EXPECT_EQ(pSysmanDeviceImp->pTelemetrySampler, pSysmanDeviceImp->pPowerHandleContext->pTelemetrySampler);
+    EXPECT_EQ(pSysmanDeviceImp->pTelemetrySampler, pSysmanDeviceImp->pFrequencyHandleContext->pTelemetrySampler);
+    EXPECT_EQ(pSysmanDeviceImp->pTelemetrySampler, pSysmanDeviceImp->pTempHandleContext->pTelemetrySampler);
+    EXPECT_EQ(pSysmanDeviceImp->pTelemetrySampler, pSysmanDeviceImp->pEngineHandleContext->pTelemetrySampler);
+}
+
 class UnknownDriverModel : public DriverModel {
   public:
     UnknownDriverModel() : DriverModel(DriverModelType::UNKNOWN) {}
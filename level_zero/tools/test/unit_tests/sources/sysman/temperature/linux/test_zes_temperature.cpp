@@ -65,17 +65,10 @@ ssize_t preadMockTemp(int fd, void *buf, size_t count, off_t offset) {
 }
 
 ssize_t preadMockTempNoSubDevices(int fd, void *buf, size_t count, off_t offset) {
-    if (count == sizeof(uint32_t)) {
-        uint32_t *mockBuf = static_cast<uint32_t *>(buf);
-        for (uint64_t i = 0; i < sizeof(uint32_t); i++) {
-            *mockBuf |= (uint32_t)tempArrForNoSubDevices[(offset - offsetForNoSubDevices) + i] << (i * 8);
-        }
-    } else {
-        uint64_t *mockBuf = static_cast<uint64_t *>(buf);
-        *mockBuf = 0;
-        for (uint64_t i = 0; i < sizeof(uint64_t); i++) {
-            *mockBuf |= (uint64_t)tempArrForNoSubDevices[(offset - offsetForNoSubDevices) + i] << (i * 8);
-        }
+    uint8_t *mockBuf = static_cast<uint8_t *>(buf);
+    for (uint64_t i = 0; i < count; i++) {
+        uint64_t index = (offset - offsetForNoSubDevices) + i;
+        mockBuf[i] = (index < sizeof(tempArrForNoSubDevices)) ? tempArrForNoSubDevices[index] : 0;
     }
     return count;
 }
@@ -7,8 +7,10 @@
 
 #include "shared/source/utilities/logger.h"
 #include "shared/source/utilities/perf_profiler.h"
+#include "shared/source/utilities/trace_recorder.h"
 
-#define API_ENTER(retValPointer) \
+#define API_ENTER(retValPointer)                                      \
+    NEO::TraceScope ApiTraceScopeForSingleCall("api", __FUNCTION__); \
     LoggerApiEnterWrapper<NEO::FileLogger<globalDebugFunctionalityLevel>::enabled()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer)
 
 #if KMD_PROFILING == 1
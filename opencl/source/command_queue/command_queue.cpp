@@ -91,6 +91,10 @@ CommandQueue::CommandQueue(Context *context, ClDevice *device, const cl_queue_pr
             auto bcsEngineType = EngineHelpers::getBcsEngineType(hwInfo, device->getDeviceBitfield(), selectorCopyEngine, internalUsage);
             bcsEngines[EngineHelpers::getBcsIndex(bcsEngineType)] = neoDevice.tryGetEngine(bcsEngineType, EngineUsage::Regular);
             bcsEngineTypes.push_back(bcsEngineType);
+
+            if (DebugManager.flags.SplitBcsCopy.get() == 1 && !internalUsage) {
+                initializeSplitBcsEngines(neoDevice);
+            }
         }
     }
 
@@ -116,9 +120,9 @@ CommandQueue::~CommandQueue() {
             device->getPerformanceCounters()->shutdown();
         }
 
-        if (auto mainBcs = bcsEngines[0]; mainBcs != nullptr) {
+        if (!bcsEngineTypes.empty() && bcsEngineTypes[0] == aub_stream::EngineType::ENGINE_BCS) {
             auto &selectorCopyEngine = device->getNearestGenericSubDevice(0)->getSelectorCopyEngine();
-            EngineHelpers::releaseBcsEngineType(mainBcs->getEngineType(), selectorCopyEngine);
+            EngineHelpers::releaseBcsEngineType(bcsEngineTypes[0], selectorCopyEngine);
         }
     }
 
@@ -931,6 +935,7 @@ void CommandQueue::overrideEngine(aub_stream::EngineType engineType, EngineUsage
         std::fill(bcsEngines.begin(), bcsEngines.end(), nullptr);
         bcsEngines[EngineHelpers::getBcsIndex(engineType)] = &device->getEngine(engineType, EngineUsage::Regular);
         bcsEngineTypes = {engineType};
+        splitBcsEngineTypes.clear();
         timestampPacketContainer = std::make_unique<TimestampPacketContainer>();
         deferredTimestampPackets = std::make_unique<TimestampPacketContainer>();
         isCopyOnly = true;
@@ -939,6 +944,53 @@ void CommandQueue::overrideEngine(aub_stream::EngineType engineType, EngineUsage
     }
 }
 
+void CommandQueue::initializeSplitBcsEngines(Device &neoDevice) {
+    auto splitBcsMask = neoDevice.getHardwareInfo().featureTable.ftrBcsInfo;
+    if (DebugManager.flags.SplitBcsMask.get() > 0) {
+        splitBcsMask &= BcsInfoMask(static_cast<uint32_t>(DebugManager.flags.SplitBcsMask.get()));
+    }
+
+    for (uint32_t bcsIndex = 0; bcsIndex < bcsInfoMaskSize; bcsIndex++) {
+        if (!splitBcsMask.test(bcsIndex)) {
+            continue;
+        }
+        const auto engineType = EngineHelpers::mapBcsIndexToEngineType(bcsIndex, true);
+        auto engine = neoDevice.tryGetEngine(engineType, EngineUsage::Regular);
+        if (engine == nullptr) {
+            continue;
+        }
+        if (bcsEngines[bcsIndex] == nullptr) {
+            bcsEngines[bcsIndex] = engine;
+        }
+        splitBcsEngineTypes.push_back(engineType);
+    }
+}
+
+bool CommandQueue::isSplitEnqueueBlitNeeded(size_t transferSize, CommandStreamReceiver &csr, cl_uint numEventsInWaitList, const cl_event *eventWaitList) {
+    if (!EngineHelpers::isBcs(csr.getOsContext().getEngineType()) || getSplitBcsChunksCount(transferSize) < 2) {
+        return false;
+    }
+
+    // Blocked enqueues are recorded as single commands, don't split them.
+    if (isQueueBlocked()) {
+        return false;
+    }
+    for (cl_uint i = 0; i < numEventsInWaitList; i++) {
+        if (castToObjectOrAbort<Event>(eventWaitList[i])->peekIsBlocked()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t CommandQueue::getSplitBcsChunksCount(size_t transferSize) const {
+    auto minimalChunkSize = static_cast<size_t>(16 * MemoryConstants::megaByte);
+    if (DebugManager.flags.SplitBcsSize.get() > 0) {
+        minimalChunkSize = static_cast<size_t>(DebugManager.flags.SplitBcsSize.get()) * MemoryConstants::kiloByte;
+    }
+    return std::min(static_cast<size_t>(splitBcsEngineTypes.size()), transferSize / minimalChunkSize);
+}
+
 void CommandQueue::aubCaptureHook(bool &blocking, bool &clearAllDependencies, const MultiDispatchInfo &multiDispatchInfo) {
     if (DebugManager.flags.AUBDumpSubCaptureMode.get()) {
         auto status = getGpgpuCommandStreamReceiver().checkAndActivateAubSubCapture(multiDispatchInfo.empty() ? "" : multiDispatchInfo.peekMainKernel()->getDescriptor().kernelMetadata.kernelName);
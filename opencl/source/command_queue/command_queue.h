@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/helpers/engine_control.h"
 #include "shared/source/utilities/range.h"
+#include "shared/source/utilities/stackvec.h"
 
 #include "opencl/source/command_queue/copy_engine_state.h"
 #include "opencl/source/command_queue/csr_selection_args.h"
@@ -330,6 +331,9 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     void fillCsrDependenciesWithLastBcsPackets(CsrDependencies &csrDeps);
     void clearLastBcsPackets();
 
+    bool isSplitEnqueueBlitNeeded(size_t transferSize, CommandStreamReceiver &csr, cl_uint numEventsInWaitList, const cl_event *eventWaitList);
+    size_t getSplitBcsChunksCount(size_t transferSize) const;
+
     // taskCount of last task
     uint32_t taskCount = 0;
 
@@ -365,6 +369,7 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     void storeProperties(const cl_queue_properties *properties);
     void processProperties(const cl_queue_properties *properties);
     void overrideEngine(aub_stream::EngineType engineType, EngineUsage engineUsage);
+    void initializeSplitBcsEngines(Device &neoDevice);
     bool bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandType, cl_bool blocking, size_t size, void *ptr,
                               cl_uint numEventsInWaitList, const cl_event *eventWaitList);
     void providePerformanceHint(TransferProperties &transferProperties);
@@ -389,6 +394,7 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     EngineControl *gpgpuEngine = nullptr;
     std::array<EngineControl *, bcsInfoMaskSize> bcsEngines = {};
     std::vector<aub_stream::EngineType> bcsEngineTypes = {};
+    StackVec<aub_stream::EngineType, bcsInfoMaskSize> splitBcsEngineTypes = {};
 
     cl_command_queue_properties commandQueueProperties = 0;
     std::vector<uint64_t> propertiesVector;
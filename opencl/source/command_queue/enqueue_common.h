@@ -168,11 +168,13 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
 
     TagNodeBase *hwTimeStamps = nullptr;
     CommandStreamReceiver &computeCommandStreamReceiver = getGpgpuCommandStreamReceiver();
-    auto commandStreamReceiverOwnership = computeCommandStreamReceiver.obtainUniqueOwnership();
 
+    // Event creation and queue timestamp query don't touch CSR state, keep them outside of CSR ownership
     EventBuilder eventBuilder;
     setupEvent(eventBuilder, event, commandType);
 
+    auto commandStreamReceiverOwnership = computeCommandStreamReceiver.obtainUniqueOwnership();
+
     bool isMarkerWithProfiling = (CL_COMMAND_MARKER == commandType) && (eventBuilder.getEvent() && eventBuilder.getEvent()->isProfilingEnabled());
 
     std::unique_ptr<KernelOperation> blockedCommandsData;
@@ -1191,14 +1193,14 @@ size_t CommandQueueHw<GfxFamily>::calculateHostPtrSizeForImage(const size_t *reg
 template <typename GfxFamily>
 template <uint32_t cmdType>
 void CommandQueueHw<GfxFamily>::enqueueBlit(const MultiDispatchInfo &multiDispatchInfo, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event, bool blocking, CommandStreamReceiver &bcsCsr) {
-    auto commandStreamReceiverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
-
     EventsRequest eventsRequest(numEventsInWaitList, eventWaitList, event);
     EventBuilder eventBuilder;
 
     setupEvent(eventBuilder, eventsRequest.outEvent, cmdType);
     eventsRequest.setupBcsCsrForOutputEvent(bcsCsr);
 
+    auto commandStreamReceiverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
+
     std::unique_ptr<KernelOperation> blockedCommandsData;
     TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
 
@@ -1280,6 +1282,68 @@ void CommandQueueHw<GfxFamily>::enqueueBlit(const MultiDispatchInfo &multiDispat
     }
 }
 
+template <typename GfxFamily>
+template <uint32_t cmdType>
+void CommandQueueHw<GfxFamily>::enqueueBlitSplit(MultiDispatchInfo &multiDispatchInfo, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event, bool blocking) {
+    auto commandStreamReceiverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
+    TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
+
+    const auto builtinOpParams = multiDispatchInfo.peekBuiltinOpParams();
+    const size_t totalSize = builtinOpParams.size.x;
+    const size_t chunksCount = getSplitBcsChunksCount(totalSize);
+    DEBUG_BREAK_IF(chunksCount < 2);
+
+    // Every chunk depends only on work enqueued before the split, so copy engines can run in parallel.
+    TimestampPacketContainer previousEnqueueNodes;
+    previousEnqueueNodes.swapNodes(*this->timestampPacketContainer);
+    TimestampPacketContainer splitNodes;
+    TimestampPacketContainer nodesForEvent;
+
+    size_t remainingSize = totalSize;
+    for (size_t chunkId = 0; chunkId < chunksCount; chunkId++) {
+        const size_t chunkSize = remainingSize / (chunksCount - chunkId);
+        const size_t chunkOffset = totalSize - remainingSize;
+        remainingSize -= chunkSize;
+
+        auto chunkParams = builtinOpParams;
+        chunkParams.srcOffset.x += chunkOffset;
+        chunkParams.dstOffset.x += chunkOffset;
+        chunkParams.size.x = chunkSize;
+        multiDispatchInfo.setBuiltinOpParams(chunkParams);
+
+        this->timestampPacketContainer->assignAndIncrementNodesRefCounts(previousEnqueueNodes);
+
+        const bool lastChunk = (remainingSize == 0);
+        auto bcsCsr = getBcsCommandStreamReceiver(splitBcsEngineTypes[chunkId]);
+        enqueueBlit<cmdType>(multiDispatchInfo, numEventsInWaitList, eventWaitList, lastChunk ? event : nullptr, false, *bcsCsr);
+
+        if (event && !lastChunk) {
+            nodesForEvent.assignAndIncrementNodesRefCounts(*this->timestampPacketContainer);
+        }
+        this->timestampPacketContainer->moveNodesToNewContainer(splitNodes);
+    }
+    multiDispatchInfo.setBuiltinOpParams(builtinOpParams);
+    previousEnqueueNodes.moveNodesToNewContainer(*deferredTimestampPackets);
+
+    if (event) {
+        auto outEvent = castToObjectOrAbort<Event>(*event);
+        for (size_t chunkId = 0; chunkId < chunksCount; chunkId++) {
+            outEvent->addSplitBcsEngine(splitBcsEngineTypes[chunkId]);
+        }
+        outEvent->addTimestampPacketNodes(nodesForEvent);
+    }
+
+    // Subsequent enqueues have to wait for all chunks.
+    this->timestampPacketContainer->swapNodes(splitNodes);
+
+    queueOwnership.unlock();
+    commandStreamReceiverOwnership.unlock();
+
+    if (blocking) {
+        waitForAllEngines(false, nullptr);
+    }
+}
+
 template <typename GfxFamily>
 template <uint32_t cmdType, size_t surfaceCount>
 void CommandQueueHw<GfxFamily>::dispatchBcsOrGpgpuEnqueue(MultiDispatchInfo &dispatchInfo, Surface *(&surfaces)[surfaceCount], EBuiltInOps::Type builtInOperation, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event, bool blocking, CommandStreamReceiver &csr) {
@@ -9,6 +9,7 @@
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/memory_manager/surface.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "opencl/source/command_queue/command_queue_hw.h"
 #include "opencl/source/command_queue/enqueue_common.h"
@@ -539,6 +540,34 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMMigrateMem(cl_uint numSvmPointers,
                                                eventWaitList,
                                                event);
 
+    auto pageFaultManager = context->getMemoryManager()->getPageFaultManager();
+    if (pageFaultManager == nullptr || DebugManager.flags.EnableUsmPrefetchMigration.get() != 1) {
+        return CL_SUCCESS;
+    }
+    // migration is only a hint: with a wait list blocked on user events the allocations
+    // are left to migrate on their next access instead of stalling the caller
+    if (isQueueBlocked()) {
+        return CL_SUCCESS;
+    }
+
+    // domains are switched in queue order, never while kernels enqueued earlier may still access the allocations
+    auto retVal = finish();
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+    for (cl_uint i = 0; i < numSvmPointers; i++) {
+        auto svmData = context->getSVMAllocsManager()->getSVMAlloc(svmPointers[i]);
+        if (svmData == nullptr) {
+            continue;
+        }
+        auto allocationPtr = reinterpret_cast<void *>(svmData->gpuAllocations.getGraphicsAllocation(getDevice().getRootDeviceIndex())->getGpuAddress());
+        if (flags & CL_MIGRATE_MEM_OBJECT_HOST) {
+            pageFaultManager->moveAllocationToCpuDomain(allocationPtr);
+        } else {
+            pageFaultManager->moveAllocationToGpuDomain(allocationPtr);
+        }
+    }
+
     return CL_SUCCESS;
 }
 } // namespace NEO
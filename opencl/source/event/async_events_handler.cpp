@@ -7,9 +7,11 @@
 
 #include "opencl/source/event/async_events_handler.h"
 
+#include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/event/event.h"
 
 #include <iterator>
@@ -41,9 +43,14 @@ Event *AsyncEventsHandler::processList() {
     Event *sleepCandidate = nullptr;
     pendingList.clear();
 
+    transferCompletedBuckets();
+
     for (auto event : list) {
         event->updateExecutionStatus();
         if (event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE))) {
+            if (tryAddToCompletionBucket(event)) {
+                continue;
+            }
             pendingList.push_back(event);
             if (event->peekTaskCount() < lowestTaskCount) {
                 sleepCandidate = event;
@@ -55,9 +62,57 @@ Event *AsyncEventsHandler::processList() {
     }
 
     list.swap(pendingList);
+
+    for (auto &bucket : completionBuckets) {
+        auto &events = bucket.second;
+        if (!events.empty() && events.begin()->first < lowestTaskCount) {
+            sleepCandidate = events.begin()->second;
+            lowestTaskCount = events.begin()->first;
+        }
+    }
     return sleepCandidate;
 }
 
+bool AsyncEventsHandler::tryAddToCompletionBucket(Event *event) {
+    auto cmdQueue = event->getCommandQueue();
+    if (cmdQueue == nullptr || event->isExternallySynchronized() || event->peekIsBlocked() ||
+        event->taskLevel == CompletionStamp::notReady || event->peekExecutionStatus() <= CL_COMPLETE) {
+        return false;
+    }
+
+    const auto taskCount = event->peekTaskCount();
+    if (taskCount == CompletionStamp::notReady) {
+        return false;
+    }
+
+    auto &csr = cmdQueue->getGpgpuCommandStreamReceiver();
+    if (csr.testTaskCountReady(csr.getTagAddress(), taskCount)) {
+        return false;
+    }
+
+    completionBuckets[&csr].emplace(taskCount, event);
+    return true;
+}
+
+void AsyncEventsHandler::transferCompletedBuckets() {
+    for (auto bucketIt = completionBuckets.begin(); bucketIt != completionBuckets.end();) {
+        auto csr = bucketIt->first;
+        auto &events = bucketIt->second;
+
+        auto eventIt = events.begin();
+        while (eventIt != events.end() && csr->testTaskCountReady(csr->getTagAddress(), eventIt->first)) {
+            list.push_back(eventIt->second);
+            eventIt = events.erase(eventIt);
+        }
+
+        if (events.empty()) {
+            bucketIt = completionBuckets.erase(bucketIt);
+        } else {
+            ++bucketIt;
+        }
+    }
+}
+
 void *AsyncEventsHandler::asyncProcess(void *arg) {
     auto self = reinterpret_cast<AsyncEventsHandler *>(arg);
     std::unique_lock<std::mutex> lock(self->asyncMtx, std::defer_lock);
@@ -71,7 +126,7 @@ void *AsyncEventsHandler::asyncProcess(void *arg) {
             self->releaseEvents();
             break;
         }
-        if (self->list.empty()) {
+        if (self->list.empty() && self->completionBuckets.empty()) {
             self->asyncCond.wait(lock);
         }
         lock.unlock();
@@ -114,6 +169,12 @@ void AsyncEventsHandler::releaseEvents() {
         event->decRefInternal();
     }
     list.clear();
+    for (auto &bucket : completionBuckets) {
+        for (auto &event : bucket.second) {
+            event.second->decRefInternal();
+        }
+    }
+    completionBuckets.clear();
     UNRECOVERABLE_IF(!registerList.empty()) // transferred before release
 }
 } // namespace NEO
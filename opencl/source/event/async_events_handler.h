@@ -8,11 +8,13 @@
 #pragma once
 #include <atomic>
 #include <condition_variable>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <vector>
 
 namespace NEO {
+class CommandStreamReceiver;
 class Event;
 class Thread;
 
@@ -29,10 +31,16 @@ class AsyncEventsHandler {
     void releaseEvents();
     MOCKABLE_VIRTUAL void openThread();
     MOCKABLE_VIRTUAL void transferRegisterList();
+    bool tryAddToCompletionBucket(Event *event);
+    void transferCompletedBuckets();
     std::vector<Event *> registerList;
     std::vector<Event *> list;
     std::vector<Event *> pendingList;
 
+    // Events waiting for gpgpu task count, bucketed per CSR and sorted by task count.
+    // Only the bucket fronts are checked against the tag, so events that can't have changed state are not scanned.
+    std::map<CommandStreamReceiver *, std::multimap<uint32_t, Event *>> completionBuckets;
+
     std::unique_ptr<Thread> thread;
     std::mutex asyncMtx;
     std::condition_variable asyncCond;
@@ -16,6 +16,7 @@
 #include "shared/source/utilities/range.h"
 #include "shared/source/utilities/stackvec.h"
 #include "shared/source/utilities/tag_allocator.h"
+#include "shared/source/utilities/trace_recorder.h"
 
 #include "opencl/extensions/public/cl_ext_private.h"
 #include "opencl/source/api/cl_types.h"
@@ -23,6 +24,7 @@
 #include "opencl/source/context/context.h"
 #include "opencl/source/event/async_events_handler.h"
 #include "opencl/source/event/event_tracker.h"
+#include "opencl/source/helpers/cl_helper.h"
 #include "opencl/source/helpers/get_info_status_mapper.h"
 #include "opencl/source/helpers/hardware_commands_helper.h"
 #include "opencl/source/mem_obj/mem_obj.h"
@@ -224,6 +226,13 @@ void Event::setupBcs(aub_stream::EngineType bcsEngineType) {
     this->bcsState.engineType = bcsEngineType;
 }
 
+void Event::addSplitBcsEngine(aub_stream::EngineType bcsEngineType) {
+    DEBUG_BREAK_IF(!EngineHelpers::isBcs(bcsEngineType));
+    if (bcsEngineType != this->bcsState.engineType) {
+        this->splitBcsEngineTypes.push_back(bcsEngineType);
+    }
+}
+
 uint32_t Event::peekBcsTaskCountFromCommandQueue() {
     if (bcsState.isValid()) {
         return this->cmdQueue->peekBcsTaskCount(bcsState.engineType);
@@ -383,6 +392,11 @@ void Event::calculateProfilingDataInternal(uint64_t contextStartTS, uint64_t con
     endTimeStamp = startTimeStamp + cpuDuration;
     completeTimeStamp = startTimeStamp + cpuCompleteDuration;
 
+    auto traceRecorder = TraceRecorder::get();
+    if (traceRecorder && !DebugManager.flags.EnableDeviceBasedTimestamps.get()) {
+        traceRecorder->recordGpuInterval(cmdTypetoString(cmdType), cmdQueue->getGpgpuCommandStreamReceiver().getOsContext().getContextId(), startTimeStamp, endTimeStamp);
+    }
+
     if (DebugManager.flags.ReturnRawGpuTimestamps.get()) {
         startTimeStamp = contextStartTS;
         endTimeStamp = contextEndTS;
@@ -420,7 +434,13 @@ inline bool Event::wait(bool blocking, bool useQuickKmdSleep) {
         }
     }
 
-    Range<CopyEngineState> states{&bcsState, bcsState.isValid() ? 1u : 0u};
+    StackVec<CopyEngineState, bcsInfoMaskSize> states;
+    if (bcsState.isValid()) {
+        states.push_back(bcsState);
+    }
+    for (auto splitBcsEngineType : splitBcsEngineTypes) {
+        states.push_back({splitBcsEngineType, cmdQueue->peekBcsTaskCount(splitBcsEngineType)});
+    }
     cmdQueue->waitUntilComplete(taskCount.load(), states, flushStamp->peekStamp(), useQuickKmdSleep);
     updateExecutionStatus();
 
@@ -458,8 +478,12 @@ void Event::updateExecutionStatus() {
         // Note : Intentional fallthrough (no return) to check for CL_COMPLETE
     }
 
-    if ((cmdQueue != nullptr) && (cmdQueue->isCompleted(getCompletionStamp(), this->bcsState))) {
+    if ((cmdQueue != nullptr) && (cmdQueue->isCompleted(getCompletionStamp(), this->bcsState)) && areSplitBcsEnginesCompleted()) {
         transitionExecutionStatus(CL_COMPLETE);
+        if (isProfilingEnabled() && TraceRecorder::get()) {
+            // traced GPU intervals are recorded when profiling data is calculated
+            calcProfilingData();
+        }
         executeCallbacks(CL_COMPLETE);
         unblockEventsBlockedByThis(CL_COMPLETE);
         auto *allocationStorage = cmdQueue->getGpgpuCommandStreamReceiver().getInternalAllocationStorage();
@@ -467,9 +491,22 @@ void Event::updateExecutionStatus() {
         return;
     }
 
+    if (cmdQueue != nullptr) {
+        // polling event status is a point where aged batched submissions get flushed
+        cmdQueue->getGpgpuCommandStreamReceiver().flushBatchedSubmissionsIfThresholdReached();
+    }
     transitionExecutionStatus(CL_SUBMITTED);
 }
 
+bool Event::areSplitBcsEnginesCompleted() const {
+    for (auto splitBcsEngineType : splitBcsEngineTypes) {
+        if (!cmdQueue->isCompleted(getCompletionStamp(), {splitBcsEngineType, 0u})) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void Event::addChild(Event &childEvent) {
     childEvent.parentCount++;
     childEvent.incRefInternal();
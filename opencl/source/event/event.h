@@ -9,10 +9,12 @@
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/os_interface/os_time.h"
 #include "shared/source/os_interface/performance_counters.h"
+#include "shared/source/sku_info/sku_info_base.h"
 #include "shared/source/utilities/arrayref.h"
 #include "shared/source/utilities/hw_timestamps.h"
 #include "shared/source/utilities/idlist.h"
 #include "shared/source/utilities/iflist.h"
+#include "shared/source/utilities/stackvec.h"
 
 #include "opencl/source/api/cl_types.h"
 #include "opencl/source/command_queue/copy_engine_state.h"
@@ -90,6 +92,7 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     ~Event() override;
 
     void setupBcs(aub_stream::EngineType bcsEngineType);
+    void addSplitBcsEngine(aub_stream::EngineType bcsEngineType);
     uint32_t peekBcsTaskCountFromCommandQueue();
 
     uint32_t getCompletionStamp() const;
@@ -308,6 +311,8 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     Event(Context *ctx, CommandQueue *cmdQueue, cl_command_type cmdType,
           uint32_t taskLevel, uint32_t taskCount);
 
+    bool areSplitBcsEnginesCompleted() const;
+
     ECallbackTarget translateToCallbackTarget(cl_int execStatus) {
         switch (execStatus) {
         default: {
@@ -373,6 +378,7 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     uint64_t endTimeStamp;
     uint64_t completeTimeStamp;
     CopyEngineState bcsState{};
+    StackVec<aub_stream::EngineType, bcsInfoMaskSize> splitBcsEngineTypes;
     bool perfCountersEnabled;
     TagNodeBase *timeStampNode = nullptr;
     TagNodeBase *perfCounterNode = nullptr;
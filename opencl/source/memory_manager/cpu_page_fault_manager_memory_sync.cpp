@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
@@ -28,4 +29,24 @@ void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
     auto allocData = memoryData[ptr].unifiedMemoryManager->getSVMAlloc(ptr);
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
 }
+void PageFaultManager::transferRangeToCpu(void *allocPtr, size_t offset, size_t size, void *cmdQ) {
+    auto commandQueue = static_cast<CommandQueue *>(cmdQ);
+    auto rangePtr = ptrOffset(allocPtr, offset);
+    auto retVal = commandQueue->enqueueSVMMap(true, CL_MAP_WRITE, rangePtr, size, 0, nullptr, nullptr, false);
+    UNRECOVERABLE_IF(retVal);
+    memoryData[allocPtr].unifiedMemoryManager->removeSvmMapOperation(rangePtr);
+}
+void PageFaultManager::transferRangeToGpu(void *allocPtr, size_t offset, size_t size, void *cmdQ) {
+    auto commandQueue = static_cast<CommandQueue *>(cmdQ);
+    auto unifiedMemoryManager = memoryData[allocPtr].unifiedMemoryManager;
+    auto rangePtr = ptrOffset(allocPtr, offset);
+    unifiedMemoryManager->insertSvmMapOperation(rangePtr, size, allocPtr, offset, false);
+    auto retVal = commandQueue->enqueueSVMUnmap(rangePtr, 0, nullptr, nullptr, false);
+    UNRECOVERABLE_IF(retVal);
+    retVal = commandQueue->finish();
+    UNRECOVERABLE_IF(retVal);
+
+    auto allocData = unifiedMemoryManager->getSVMAlloc(allocPtr);
+    this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
+}
 } // namespace NEO
@@ -5,6 +5,9 @@
  *
  */
 
+#include "shared/source/utilities/binary_log_writer.h"
+#include "shared/source/utilities/trace_recorder.h"
+
 #include "opencl/source/platform/platform.h"
 
 namespace NEO {
@@ -14,5 +17,7 @@ void __attribute__((constructor)) platformsConstructor() {
 void __attribute__((destructor)) platformsDestructor() {
     delete platformsImpl;
     platformsImpl = nullptr;
+    BinaryLogWriter::shutdownAll();
+    TraceRecorder::shutdownGlobal();
 }
 } // namespace NEO
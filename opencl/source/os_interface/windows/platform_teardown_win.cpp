@@ -5,6 +5,9 @@
  *
  */
 
+#include "shared/source/utilities/binary_log_writer.h"
+#include "shared/source/utilities/trace_recorder.h"
+
 #include "opencl/source/platform/platform.h"
 
 using namespace NEO;
@@ -12,6 +15,8 @@ using namespace NEO;
 BOOL APIENTRY DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved) {
     if (fdwReason == DLL_PROCESS_DETACH) {
         delete platformsImpl;
+        BinaryLogWriter::shutdownAll();
+        TraceRecorder::shutdownGlobal();
     }
     if (fdwReason == DLL_PROCESS_ATTACH) {
         platformsImpl = new std::vector<std::unique_ptr<Platform>>;
@@ -16,8 +16,22 @@ namespace HostSideTracing {
 std::atomic<uint32_t> tracingState(0);
 TracingHandle *tracingHandle[TRACING_MAX_HANDLE_COUNT] = {nullptr};
 std::atomic<uint32_t> tracingCorrelationId(0);
+TracingThreadSlot tracingThreadSlots[TRACING_MAX_THREAD_SLOTS];
+
+namespace {
+struct TracingThreadSlotOwner {
+    ~TracingThreadSlotOwner() {
+        if (slot) {
+            DEBUG_BREAK_IF(slot->activeClients.load(std::memory_order_acquire) != 0);
+            slot->inUse.store(false, std::memory_order_release);
+        }
+    }
+    TracingThreadSlot *slot = nullptr;
+    bool slotRequested = false;
+};
+thread_local TracingThreadSlotOwner tracingThreadSlotOwner;
 
-bool addTracingClient() {
+bool addGlobalTracingClient() {
     uint32_t state = tracingState.load(std::memory_order_acquire);
     state = TRACING_SET_ENABLED_BIT(state);
     state = TRACING_UNSET_LOCKED_BIT(state);
@@ -37,12 +51,70 @@ bool addTracingClient() {
     return true;
 }
 
-void removeTracingClient() {
+void removeGlobalTracingClient() {
     DEBUG_BREAK_IF(!TRACING_GET_ENABLED_BIT(tracingState.load(std::memory_order_acquire)));
     DEBUG_BREAK_IF(TRACING_GET_LOCKED_BIT(tracingState.load(std::memory_order_acquire)));
     DEBUG_BREAK_IF(TRACING_GET_CLIENT_COUNTER(tracingState.load(std::memory_order_acquire)) == 0);
     tracingState.fetch_sub(1, std::memory_order_acq_rel);
 }
+} // namespace
+
+TracingThreadSlot *getTracingThreadSlot() {
+    if (!tracingThreadSlotOwner.slotRequested) {
+        tracingThreadSlotOwner.slotRequested = true;
+        for (auto &slot : tracingThreadSlots) {
+            bool inUse = false;
+            if (!slot.inUse.load(std::memory_order_relaxed) &&
+                slot.inUse.compare_exchange_strong(inUse, true, std::memory_order_acq_rel)) {
+                tracingThreadSlotOwner.slot = &slot;
+                break;
+            }
+        }
+    }
+    return tracingThreadSlotOwner.slot;
+}
+
+bool addTracingClient() {
+    auto slot = getTracingThreadSlot();
+    if (slot == nullptr) {
+        return addGlobalTracingClient();
+    }
+
+    // only the owning thread modifies its slot
+    auto activeClients = slot->activeClients.load(std::memory_order_relaxed);
+    if (activeClients > 0) {
+        // nested call from a tracing callback, tracing state cannot change until the outer client leaves
+        slot->activeClients.store(activeClients + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    AtomicBackoff backoff;
+    while (true) {
+        // pairs with LockTracingState: either the lock holder sees this client or this client sees the lock
+        slot->activeClients.store(1, std::memory_order_seq_cst);
+        uint32_t state = tracingState.load(std::memory_order_seq_cst);
+        if (!TRACING_GET_ENABLED_BIT(state)) {
+            slot->activeClients.store(0, std::memory_order_release);
+            return false;
+        }
+        if (!TRACING_GET_LOCKED_BIT(state)) {
+            return true;
+        }
+        slot->activeClients.store(0, std::memory_order_release);
+        backoff.pause();
+    }
+}
+
+void removeTracingClient() {
+    auto slot = tracingThreadSlotOwner.slot;
+    if (slot == nullptr) {
+        removeGlobalTracingClient();
+        return;
+    }
+    auto activeClients = slot->activeClients.load(std::memory_order_relaxed);
+    DEBUG_BREAK_IF(activeClients == 0);
+    slot->activeClients.store(activeClients - 1, std::memory_order_release);
+}
 
 static void LockTracingState() {
     uint32_t state = tracingState.load(std::memory_order_acquire);
@@ -50,11 +122,16 @@ static void LockTracingState() {
     state = TRACING_UNSET_LOCKED_BIT(state);
     AtomicBackoff backoff;
     while (!tracingState.compare_exchange_weak(state, TRACING_SET_LOCKED_BIT(state),
-                                               std::memory_order_release, std::memory_order_acquire)) {
+                                               std::memory_order_seq_cst, std::memory_order_acquire)) {
         state = TRACING_ZERO_CLIENT_COUNTER(state);
         state = TRACING_UNSET_LOCKED_BIT(state);
         backoff.pause();
     }
+    for (auto &slot : tracingThreadSlots) {
+        while (slot.activeClients.load(std::memory_order_seq_cst) != 0) {
+            backoff.pause();
+        }
+    }
     DEBUG_BREAK_IF(!TRACING_GET_LOCKED_BIT(tracingState.load(std::memory_order_acquire)));
     DEBUG_BREAK_IF(TRACING_GET_CLIENT_COUNTER(tracingState.load(std::memory_order_acquire)) > 0);
 }
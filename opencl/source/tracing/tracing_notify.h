@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "shared/source/helpers/constants.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 
 #include "opencl/source/tracing/tracing_handle.h"
@@ -55,12 +56,23 @@ constexpr size_t TRACING_MAX_HANDLE_COUNT = 16;
 constexpr uint32_t TRACING_STATE_ENABLED_BIT = 0x80000000u;
 constexpr uint32_t TRACING_STATE_LOCKED_BIT = 0x40000000u;
 
+constexpr size_t TRACING_MAX_THREAD_SLOTS = 256;
+
+// Tracing clients of a thread are counted in its own cache line, so API calls of different threads
+// only read tracingState. Threads which did not get a slot fall back to the client counter in tracingState.
+struct alignas(MemoryConstants::cacheLineSize) TracingThreadSlot {
+    std::atomic<uint32_t> activeClients{0};
+    std::atomic<bool> inUse{false};
+};
+
 extern std::atomic<uint32_t> tracingState;
 extern TracingHandle *tracingHandle[TRACING_MAX_HANDLE_COUNT];
 extern std::atomic<uint32_t> tracingCorrelationId;
+extern TracingThreadSlot tracingThreadSlots[TRACING_MAX_THREAD_SLOTS];
 
 bool addTracingClient();
 void removeTracingClient();
+TracingThreadSlot *getTracingThreadSlot();
 
 class AtomicBackoff {
   public:
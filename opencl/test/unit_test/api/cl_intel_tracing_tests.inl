@@ -217,6 +217,56 @@ TEST_F(IntelTracingTest, GivenTwoHandlesWhenCallingTracingFunctionsThenSuccessIs
     EXPECT_EQ(CL_SUCCESS, status);
 }
 
+struct IntelTracingThreadSlotTest : public IntelTracingTest {
+  protected:
+    void vcallback(cl_function_id fid, cl_callback_data *callbackData, void *userData) override {
+        if (callbackData->site != CL_CALLBACK_SITE_ENTER) {
+            return;
+        }
+        auto slot = HostSideTracing::getTracingThreadSlot();
+        ASSERT_NE(nullptr, slot);
+        if (fid == CL_FUNCTION_clGetDeviceInfo) {
+            globalClientCounter = TRACING_GET_CLIENT_COUNTER(HostSideTracing::tracingState.load());
+            threadSlotClients = slot->activeClients.load();
+            cl_platform_id platform = nullptr;
+            clGetDeviceInfo(testedClDevice, CL_DEVICE_PLATFORM, sizeof(platform), &platform, nullptr);
+            char name[256] = {};
+            clGetPlatformInfo(platform, CL_PLATFORM_NAME, sizeof(name), name, nullptr);
+        } else if (fid == CL_FUNCTION_clGetPlatformInfo) {
+            nestedThreadSlotClients = slot->activeClients.load();
+        }
+    }
+
+    uint32_t globalClientCounter = std::numeric_limits<uint32_t>::max();
+    uint32_t threadSlotClients = 0u;
+    uint32_t nestedThreadSlotClients = 0u;
+};
+
+TEST_F(IntelTracingThreadSlotTest, GivenTracingEnabledWhenApiFunctionIsCalledThenTracingClientIsCountedInThreadSlot) {
+    status = clCreateTracingHandleINTEL(testedClDevice, callback, this, &handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+    status = clSetTracingPointINTEL(handle, CL_FUNCTION_clGetDeviceInfo, CL_TRUE);
+    EXPECT_EQ(CL_SUCCESS, status);
+    status = clSetTracingPointINTEL(handle, CL_FUNCTION_clGetPlatformInfo, CL_TRUE);
+    EXPECT_EQ(CL_SUCCESS, status);
+    status = clEnableTracingINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+
+    cl_uint computeUnits = 0u;
+    status = clGetDeviceInfo(testedClDevice, CL_DEVICE_MAX_COMPUTE_UNITS, sizeof(computeUnits), &computeUnits, nullptr);
+    EXPECT_EQ(CL_SUCCESS, status);
+
+    EXPECT_EQ(0u, globalClientCounter);
+    EXPECT_EQ(1u, threadSlotClients);
+    EXPECT_EQ(2u, nestedThreadSlotClients);
+    EXPECT_EQ(0u, HostSideTracing::getTracingThreadSlot()->activeClients.load());
+
+    status = clDisableTracingINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+    status = clDestroyTracingHandleINTEL(handle);
+    EXPECT_EQ(CL_SUCCESS, status);
+}
+
 struct IntelAllTracingTest : public IntelTracingTest {
   public:
     IntelAllTracingTest() {}
@@ -1484,6 +1484,47 @@ HWTEST_TEMPLATED_F(BlitEnqueueTaskCountTests, givenBlockedEventWhenWaitingForCom
     EXPECT_FALSE(commandQueue->isQueueBlocked());
 }
 
+HWTEST_TEMPLATED_F(BlitEnqueueTaskCountTests, givenOutputEventWhenEnqueueingBlitThenEventHasGpgpuAndBcsTaskCountsSet) {
+    auto buffer = createBuffer(1, false);
+    buffer->forceDisallowCPUCopy = true;
+    int hostPtr = 0;
+
+    cl_event outEvent = nullptr;
+    commandQueue->enqueueWriteBuffer(buffer.get(), false, 0, 1, &hostPtr, nullptr, 0, nullptr, &outEvent);
+    ASSERT_NE(nullptr, outEvent);
+
+    auto event = castToObject<Event>(outEvent);
+    EXPECT_EQ(gpgpuCsr->peekTaskCount(), event->peekTaskCount());
+    EXPECT_EQ(commandQueue->taskCount, event->peekTaskCount());
+    EXPECT_EQ(bcsCsr->peekTaskCount(), event->peekBcsTaskCountFromCommandQueue());
+
+    clReleaseEvent(outEvent);
+}
+
+HWTEST_TEMPLATED_F(BlitEnqueueTaskCountTests, givenBlockedQueueAndOutputEventWhenEnqueueingBlitThenTaskCountsAreSetAfterUnblocking) {
+    auto buffer = createBuffer(1, false);
+    buffer->forceDisallowCPUCopy = true;
+    int hostPtr = 0;
+
+    UserEvent userEvent;
+    cl_event waitlist = &userEvent;
+    cl_event outEvent = nullptr;
+    commandQueue->enqueueWriteBuffer(buffer.get(), false, 0, 1, &hostPtr, nullptr, 1, &waitlist, &outEvent);
+    ASSERT_NE(nullptr, outEvent);
+    EXPECT_TRUE(commandQueue->isQueueBlocked());
+
+    auto event = castToObject<Event>(outEvent);
+    EXPECT_EQ(CompletionStamp::notReady, event->peekTaskCount());
+
+    userEvent.setStatus(CL_COMPLETE);
+
+    EXPECT_FALSE(commandQueue->isQueueBlocked());
+    EXPECT_EQ(gpgpuCsr->peekTaskCount(), event->peekTaskCount());
+    EXPECT_EQ(bcsCsr->peekTaskCount(), event->peekBcsTaskCountFromCommandQueue());
+
+    clReleaseEvent(outEvent);
+}
+
 HWTEST_TEMPLATED_F(BlitEnqueueTaskCountTests, givenBlockedEnqueueWithoutKernelWhenWaitingForCompletionThenWaitForCurrentBcsTaskCount) {
     auto ultGpgpuCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(gpgpuCsr);
     auto ultBcsCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(bcsCsr);
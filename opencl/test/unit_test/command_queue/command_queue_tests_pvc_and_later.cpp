@@ -7,9 +7,12 @@
 
 #include "shared/source/helpers/engine_node_helper.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/test_macros/test.h"
+#include "shared/test/unit_test/utilities/base_object_utils.h"
 
+#include "opencl/source/event/event.h"
 #include "opencl/test/unit_test/mocks/mock_buffer.h"
 #include "opencl/test/unit_test/mocks/mock_cl_device.h"
 #include "opencl/test/unit_test/mocks/mock_command_queue.h"
@@ -460,3 +463,212 @@ HWTEST2_F(BcsCsrSelectionCommandQueueTests, givenMultipleEnginesInQueueWhenSelec
         EXPECT_EQ(queue->getBcsCommandStreamReceiver(aub_stream::ENGINE_BCS2), &queue->selectCsrForBuiltinOperation(args));
     }
 }
+
+HWTEST2_F(CommandQueuePvcAndLaterTests, givenSplitBcsCopyEnabledWhenCreatingCommandQueueThenAllAvailableCopyEnginesAreUsedForSplit, IsAtLeastXeHpcCore) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.SplitBcsCopy.set(1);
+
+    HardwareInfo hwInfo = *defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = maxNBitValue(9);
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    MockDevice *device = MockDevice::createWithNewExecutionEnvironment<MockDevice>(&hwInfo, 0);
+    MockClDevice clDevice{device};
+    MockContext context{&clDevice};
+
+    MockCommandQueue queue{context};
+    EXPECT_EQ(9u, queue.splitBcsEngineTypes.size());
+    EXPECT_EQ(9u, queue.countBcsEngines());
+    EXPECT_EQ(aub_stream::EngineType::ENGINE_BCS, queue.splitBcsEngineTypes[0]);
+    EXPECT_EQ(aub_stream::EngineType::ENGINE_BCS8, queue.splitBcsEngineTypes[8]);
+    for (auto engineType : queue.splitBcsEngineTypes) {
+        EXPECT_NE(nullptr, queue.getBcsCommandStreamReceiver(engineType));
+    }
+}
+
+HWTEST2_F(CommandQueuePvcAndLaterTests, givenSplitBcsMaskWhenCreatingCommandQueueThenOnlySelectedCopyEnginesAreUsedForSplit, IsAtLeastXeHpcCore) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.SplitBcsMask.set(0b110);
+
+    HardwareInfo hwInfo = *defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = maxNBitValue(9);
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    MockDevice *device = MockDevice::createWithNewExecutionEnvironment<MockDevice>(&hwInfo, 0);
+    MockClDevice clDevice{device};
+    MockContext context{&clDevice};
+
+    MockCommandQueue queue{context};
+    ASSERT_EQ(2u, queue.splitBcsEngineTypes.size());
+    EXPECT_EQ(aub_stream::EngineType::ENGINE_BCS1, queue.splitBcsEngineTypes[0]);
+    EXPECT_EQ(aub_stream::EngineType::ENGINE_BCS2, queue.splitBcsEngineTypes[1]);
+}
+
+HWTEST2_F(CommandQueuePvcAndLaterTests, givenSplitBcsCopyDisabledWhenCreatingCommandQueueThenNoCopyEnginesAreUsedForSplit, IsAtLeastXeHpcCore) {
+    HardwareInfo hwInfo = *defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = maxNBitValue(9);
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    MockDevice *device = MockDevice::createWithNewExecutionEnvironment<MockDevice>(&hwInfo, 0);
+    MockClDevice clDevice{device};
+    MockContext context{&clDevice};
+
+    MockCommandQueue queue{context};
+    EXPECT_EQ(0u, queue.splitBcsEngineTypes.size());
+    EXPECT_EQ(1u, queue.countBcsEngines());
+    EXPECT_FALSE(queue.isSplitEnqueueBlitNeeded(MemoryConstants::gigaByte, *queue.getBcsCommandStreamReceiver(queue.bcsEngineTypes[0]), 0, nullptr));
+}
+
+HWTEST2_F(CommandQueuePvcAndLaterTests, givenSplitBcsSizeWhenGettingSplitChunksCountThenTransferIsSplitIntoChunksNotSmallerThanSplitSize, IsAtLeastXeHpcCore) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.SplitBcsMask.set(0b1111);
+    DebugManager.flags.SplitBcsSize.set(1024);
+
+    HardwareInfo hwInfo = *defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = maxNBitValue(9);
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    MockDevice *device = MockDevice::createWithNewExecutionEnvironment<MockDevice>(&hwInfo, 0);
+    MockClDevice clDevice{device};
+    MockContext context{&clDevice};
+
+    MockCommandQueue queue{context};
+    auto &bcsCsr = *queue.getBcsCommandStreamReceiver(aub_stream::EngineType::ENGINE_BCS1);
+
+    EXPECT_EQ(0u, queue.getSplitBcsChunksCount(MemoryConstants::megaByte - 1));
+    EXPECT_EQ(1u, queue.getSplitBcsChunksCount(MemoryConstants::megaByte));
+    EXPECT_EQ(3u, queue.getSplitBcsChunksCount(3 * MemoryConstants::megaByte));
+    EXPECT_EQ(4u, queue.getSplitBcsChunksCount(64 * MemoryConstants::megaByte));
+
+    EXPECT_FALSE(queue.isSplitEnqueueBlitNeeded(MemoryConstants::megaByte, bcsCsr, 0, nullptr));
+    EXPECT_TRUE(queue.isSplitEnqueueBlitNeeded(2 * MemoryConstants::megaByte, bcsCsr, 0, nullptr));
+    EXPECT_FALSE(queue.isSplitEnqueueBlitNeeded(2 * MemoryConstants::megaByte, queue.getGpgpuCommandStreamReceiver(), 0, nullptr));
+}
+
+struct SplitBcsCopyCommandQueueTests : ::testing::Test {
+    void SetUp() override {
+        DebugManager.flags.SplitBcsCopy.set(1);
+        DebugManager.flags.SplitBcsMask.set(0b111);
+        DebugManager.flags.SplitBcsSize.set(1);
+        DebugManager.flags.EnableBlitterForEnqueueOperations.set(1);
+
+        HardwareInfo hwInfo = *::defaultHwInfo;
+        hwInfo.capabilityTable.blitterOperationsSupported = true;
+        hwInfo.featureTable.ftrBcsInfo = maxNBitValue(9);
+
+        device = MockDevice::createWithNewExecutionEnvironment<MockDevice>(&hwInfo);
+        clDevice = std::make_unique<MockClDevice>(device);
+        context = std::make_unique<MockContext>(clDevice.get());
+
+        buffer = clUniquePtr<Buffer>(Buffer::create(context.get(), CL_MEM_READ_WRITE, bufferSize, nullptr, retVal));
+        ASSERT_EQ(CL_SUCCESS, retVal);
+        buffer->forceDisallowCPUCopy = true;
+    }
+
+    template <typename FamilyType>
+    UltCommandStreamReceiver<FamilyType> &getUltBcsCsr(CommandQueue &queue, aub_stream::EngineType engineType) {
+        return static_cast<UltCommandStreamReceiver<FamilyType> &>(*queue.getBcsCommandStreamReceiver(engineType));
+    }
+
+    // 3KB + 2 split into 3 chunks of at least 1KB, the remainder goes to the last chunks
+    static constexpr size_t transferSize = 3 * MemoryConstants::kiloByte + 2;
+    static constexpr size_t bufferOffset = 16;
+    static constexpr size_t bufferSize = 4 * MemoryConstants::kiloByte;
+    static constexpr std::array<aub_stream::EngineType, 3> splitEngines = {{aub_stream::ENGINE_BCS, aub_stream::ENGINE_BCS1, aub_stream::ENGINE_BCS2}};
+    static constexpr std::array<size_t, 3> chunkOffsets = {{0, 1024, 2049}};
+    static constexpr std::array<size_t, 3> chunkSizes = {{1024, 1025, 1025}};
+
+    DebugManagerStateRestore restore;
+    MockDevice *device = nullptr;
+    std::unique_ptr<MockClDevice> clDevice;
+    std::unique_ptr<MockContext> context;
+    ReleaseableObjectPtr<Buffer> buffer;
+    cl_int retVal = CL_SUCCESS;
+    alignas(MemoryConstants::pageSize) uint8_t hostMemory[bufferSize] = {};
+};
+
+HWTEST2_F(SplitBcsCopyCommandQueueTests, givenSplitBcsCopyWhenEnqueueReadBufferThenEachEngineCopiesItsChunkWithProperOffsetsAndRemainderGoesToLastChunks, IsAtLeastXeHpcCore) {
+    MockCommandQueueHw<FamilyType> queue(context.get(), clDevice.get(), nullptr);
+    ASSERT_EQ(3u, queue.getSplitBcsChunksCount(transferSize));
+
+    EXPECT_EQ(CL_SUCCESS, queue.enqueueReadBuffer(buffer.get(), CL_FALSE, bufferOffset, transferSize, hostMemory, nullptr, 0, nullptr, nullptr));
+
+    size_t copiedSize = 0;
+    for (size_t chunkId = 0; chunkId < splitEngines.size(); chunkId++) {
+        auto &bcsCsr = getUltBcsCsr<FamilyType>(queue, splitEngines[chunkId]);
+        EXPECT_EQ(1u, bcsCsr.blitBufferCalled);
+        ASSERT_EQ(1u, bcsCsr.receivedBlitProperties.size());
+
+        auto &blitProperties = bcsCsr.receivedBlitProperties[0];
+        EXPECT_EQ(BlitterConstants::BlitDirection::BufferToHostPtr, blitProperties.blitDirection);
+        EXPECT_EQ(bufferOffset + chunkOffsets[chunkId], blitProperties.srcOffset.x);
+        EXPECT_EQ(chunkOffsets[chunkId], blitProperties.dstOffset.x);
+        EXPECT_EQ(chunkSizes[chunkId], blitProperties.copySize.x);
+        copiedSize += blitProperties.copySize.x;
+    }
+    EXPECT_EQ(transferSize, copiedSize);
+}
+
+HWTEST2_F(SplitBcsCopyCommandQueueTests, givenSplitBcsCopyWhenEnqueueWriteBufferThenEachEngineCopiesItsChunkWithProperOffsetsAndRemainderGoesToLastChunks, IsAtLeastXeHpcCore) {
+    MockCommandQueueHw<FamilyType> queue(context.get(), clDevice.get(), nullptr);
+
+    EXPECT_EQ(CL_SUCCESS, queue.enqueueWriteBuffer(buffer.get(), CL_FALSE, bufferOffset, transferSize, hostMemory, nullptr, 0, nullptr, nullptr));
+
+    size_t copiedSize = 0;
+    for (size_t chunkId = 0; chunkId < splitEngines.size(); chunkId++) {
+        auto &bcsCsr = getUltBcsCsr<FamilyType>(queue, splitEngines[chunkId]);
+        EXPECT_EQ(1u, bcsCsr.blitBufferCalled);
+        ASSERT_EQ(1u, bcsCsr.receivedBlitProperties.size());
+
+        auto &blitProperties = bcsCsr.receivedBlitProperties[0];
+        EXPECT_EQ(BlitterConstants::BlitDirection::HostPtrToBuffer, blitProperties.blitDirection);
+        EXPECT_EQ(chunkOffsets[chunkId], blitProperties.srcOffset.x);
+        EXPECT_EQ(bufferOffset + chunkOffsets[chunkId], blitProperties.dstOffset.x);
+        EXPECT_EQ(chunkSizes[chunkId], blitProperties.copySize.x);
+        copiedSize += blitProperties.copySize.x;
+    }
+    EXPECT_EQ(transferSize, copiedSize);
+}
+
+HWTEST2_F(SplitBcsCopyCommandQueueTests, givenSplitBcsCopyWithEventWhenNotAllEnginesReachedTheirTaskCountThenEventIsNotCompleted, IsAtLeastXeHpcCore) {
+    MockCommandQueueHw<FamilyType> queue(context.get(), clDevice.get(), nullptr);
+
+    cl_event clEvent = nullptr;
+    EXPECT_EQ(CL_SUCCESS, queue.enqueueReadBuffer(buffer.get(), CL_FALSE, bufferOffset, transferSize, hostMemory, nullptr, 0, nullptr, &clEvent));
+    ASSERT_NE(nullptr, clEvent);
+    auto event = castToObject<Event>(clEvent);
+
+    for (auto engineType : splitEngines) {
+        auto &bcsCsr = getUltBcsCsr<FamilyType>(queue, engineType);
+        ASSERT_NE(0u, bcsCsr.peekTaskCount());
+        *bcsCsr.getTagAddress() = 0u;
+    }
+
+    // last chunk engine is tracked by the event's own bcs state, the remaining ones as split engines
+    for (auto engineType : {aub_stream::ENGINE_BCS2, aub_stream::ENGINE_BCS, aub_stream::ENGINE_BCS1}) {
+        EXPECT_EQ(CL_SUBMITTED, event->updateEventAndReturnCurrentStatus());
+
+        auto &bcsCsr = getUltBcsCsr<FamilyType>(queue, engineType);
+        *bcsCsr.getTagAddress() = bcsCsr.peekTaskCount();
+    }
+
+    EXPECT_EQ(CL_COMPLETE, event->updateEventAndReturnCurrentStatus());
+
+    clReleaseEvent(clEvent);
+}
+
+HWTEST2_F(SplitBcsCopyCommandQueueTests, givenSplitBcsCopyWhenBlockingEnqueueReadBufferThenWaitForAllEnginesUsedBySplit, IsAtLeastXeHpcCore) {
+    MockCommandQueueHw<FamilyType> queue(context.get(), clDevice.get(), nullptr);
+
+    for (auto engineType : splitEngines) {
+        EXPECT_EQ(0u, getUltBcsCsr<FamilyType>(queue, engineType).waitForCompletionWithTimeoutTaskCountCalled.load());
+    }
+
+    EXPECT_EQ(CL_SUCCESS, queue.enqueueReadBuffer(buffer.get(), CL_TRUE, bufferOffset, transferSize, hostMemory, nullptr, 0, nullptr, nullptr));
+
+    for (auto engineType : splitEngines) {
+        auto &bcsCsr = getUltBcsCsr<FamilyType>(queue, engineType);
+        EXPECT_EQ(1u, bcsCsr.blitBufferCalled);
+        EXPECT_NE(0u, bcsCsr.waitForCompletionWithTimeoutTaskCountCalled.load());
+        EXPECT_EQ(bcsCsr.peekTaskCount(), bcsCsr.latestWaitForCompletionWithTimeoutTaskCount.load());
+    }
+    EXPECT_EQ(queue.taskCount, queue.latestTaskCountWaited.load());
+}
@@ -10,11 +10,13 @@
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/engine_descriptor_helper.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
+#include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_aub_csr.h"
 #include "shared/test/common/mocks/mock_aub_subcapture_manager.h"
 #include "shared/test/common/mocks/mock_csr.h"
 #include "shared/test/common/mocks/mock_internal_allocation_storage.h"
 #include "shared/test/common/mocks/mock_os_context.h"
+#include "shared/test/common/mocks/mock_ostime.h"
 #include "shared/test/common/mocks/mock_timestamp_container.h"
 #include "shared/test/common/test_macros/test.h"
 #include "shared/test/unit_test/utilities/base_object_utils.h"
@@ -27,6 +29,7 @@
 #include "opencl/test/unit_test/helpers/cl_hw_parse.h"
 #include "opencl/test/unit_test/mocks/mock_command_queue.h"
 #include "opencl/test/unit_test/mocks/mock_context.h"
+#include "opencl/test/unit_test/mocks/mock_event.h"
 #include "opencl/test/unit_test/mocks/mock_kernel.h"
 #include "opencl/test/unit_test/mocks/mock_mdi.h"
 #include "opencl/test/unit_test/mocks/mock_platform.h"
@@ -765,3 +768,83 @@ HWTEST_F(EnqueueHandlerTestBasic, givenBlockedEnqueueHandlerWhenCommandIsBloking
 
     t0.join();
 }
+
+template <typename GfxFamily>
+class OutputEventCheckingCsr : public UltCommandStreamReceiver<GfxFamily> {
+  public:
+    using UltCommandStreamReceiver<GfxFamily>::UltCommandStreamReceiver;
+
+    std::unique_lock<CommandStreamReceiver::MutexType> obtainUniqueOwnership() override {
+        if (outputEvent && !ownershipObtained) {
+            ownershipObtained = true;
+            eventCreatedBeforeOwnership = (*outputEvent != nullptr);
+        }
+        return UltCommandStreamReceiver<GfxFamily>::obtainUniqueOwnership();
+    }
+
+    cl_event *outputEvent = nullptr;
+    bool ownershipObtained = false;
+    bool eventCreatedBeforeOwnership = false;
+};
+
+HWTEST_F(EnqueueHandlerTest, givenProfilingQueueWhenEnqueuingWithOutputEventThenEventIsCreatedBeforeCsrOwnershipAndHasQueueTimestampAndTaskCountSet) {
+    pClDevice->setOSTime(new MockOSTimeWithConstTimestamp());
+    auto csr = new OutputEventCheckingCsr<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    pDevice->resetCommandStreamReceiver(csr);
+
+    MockKernelWithInternals kernelInternals(*pClDevice, context);
+    MockMultiDispatchInfo multiDispatchInfo(pClDevice, kernelInternals.mockKernel);
+    cl_queue_properties props[3] = {CL_QUEUE_PROPERTIES, CL_QUEUE_PROFILING_ENABLE, 0};
+    auto mockCmdQ = clUniquePtr(new MockCommandQueueHw<FamilyType>(context, pClDevice, props));
+
+    cl_event outputEvent = nullptr;
+    csr->outputEvent = &outputEvent;
+    mockCmdQ->template enqueueHandler<CL_COMMAND_NDRANGE_KERNEL>(nullptr, 0, false, multiDispatchInfo, 0, nullptr, &outputEvent);
+
+    EXPECT_TRUE(csr->ownershipObtained);
+    EXPECT_TRUE(csr->eventCreatedBeforeOwnership);
+    ASSERT_NE(nullptr, outputEvent);
+
+    auto event = static_cast<MockEvent<Event> *>(castToObjectOrAbort<Event>(outputEvent));
+    EXPECT_EQ(MockDeviceTimeWithConstTimestamp::CPU_TIME_IN_NS, event->queueTimeStamp.CPUTimeinNS);
+    EXPECT_EQ(MockDeviceTimeWithConstTimestamp::GPU_TIMESTAMP, event->queueTimeStamp.GPUTimeStamp);
+    EXPECT_EQ(csr->peekTaskCount(), event->peekTaskCount());
+    EXPECT_EQ(mockCmdQ->taskCount, event->peekTaskCount());
+
+    event->release();
+}
+
+HWTEST_F(EnqueueHandlerTest, givenBlockedProfilingQueueWhenEnqueuingWithOutputEventThenEventIsCreatedBeforeCsrOwnershipAndTaskCountIsSetAfterUnblocking) {
+    pClDevice->setOSTime(new MockOSTimeWithConstTimestamp());
+    auto csr = new OutputEventCheckingCsr<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    pDevice->resetCommandStreamReceiver(csr);
+
+    MockKernelWithInternals kernelInternals(*pClDevice, context);
+    MockMultiDispatchInfo multiDispatchInfo(pClDevice, kernelInternals.mockKernel);
+    cl_queue_properties props[3] = {CL_QUEUE_PROPERTIES, CL_QUEUE_PROFILING_ENABLE, 0};
+    auto mockCmdQ = clUniquePtr(new MockCommandQueueHw<FamilyType>(context, pClDevice, props));
+
+    UserEvent userEvent(context);
+    cl_event waitlist[] = {&userEvent};
+    cl_event outputEvent = nullptr;
+    csr->outputEvent = &outputEvent;
+    mockCmdQ->template enqueueHandler<CL_COMMAND_NDRANGE_KERNEL>(nullptr, 0, false, multiDispatchInfo, 1, waitlist, &outputEvent);
+
+    EXPECT_TRUE(csr->ownershipObtained);
+    EXPECT_TRUE(csr->eventCreatedBeforeOwnership);
+    ASSERT_NE(nullptr, outputEvent);
+    EXPECT_TRUE(mockCmdQ->isQueueBlocked());
+
+    auto event = static_cast<MockEvent<Event> *>(castToObjectOrAbort<Event>(outputEvent));
+    EXPECT_EQ(MockDeviceTimeWithConstTimestamp::CPU_TIME_IN_NS, event->queueTimeStamp.CPUTimeinNS);
+    EXPECT_EQ(MockDeviceTimeWithConstTimestamp::GPU_TIMESTAMP, event->queueTimeStamp.GPUTimeStamp);
+    EXPECT_EQ(CompletionStamp::notReady, event->peekTaskCount());
+
+    userEvent.setStatus(CL_COMPLETE);
+
+    EXPECT_FALSE(mockCmdQ->isQueueBlocked());
+    EXPECT_NE(CompletionStamp::notReady, event->peekTaskCount());
+    EXPECT_EQ(csr->peekTaskCount(), event->peekTaskCount());
+
+    event->release();
+}
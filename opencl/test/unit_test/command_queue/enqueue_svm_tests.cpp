@@ -1928,6 +1928,102 @@ TEST_F(EnqueueSvmTest, givenPageFaultManagerWhenEnqueueMemFillThenAllocIsDecommi
     context->memoryManager = memoryManager;
 }
 
+TEST_F(EnqueueSvmTest, givenPrefetchMigrationEnabledWhenEnqueueSvmMigrateMemThenAllocIsMovedToRequestedDomain) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableUsmPrefetchMigration.set(1);
+
+    auto mockMemoryManager = std::make_unique<MockMemoryManager>();
+    auto mockPageFaultManager = new MockPageFaultManager();
+    mockMemoryManager->pageFaultManager.reset(mockPageFaultManager);
+    auto memoryManager = context->getMemoryManager();
+    context->memoryManager = mockMemoryManager.get();
+    mockPageFaultManager->insertAllocation(ptrSVM, 256, context->getSVMAllocsManager(), context->getSpecialQueue(0u), {});
+
+    const void *svmPtrs[] = {ptrSVM};
+    retVal = pCmdQ->enqueueSVMMigrateMem(1, svmPtrs, nullptr, 0, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(1, mockPageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(1, mockPageFaultManager->protectMemoryCalled);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Gpu, mockPageFaultManager->memoryData[ptrSVM].domain);
+
+    retVal = pCmdQ->enqueueSVMMigrateMem(1, svmPtrs, nullptr, CL_MIGRATE_MEM_OBJECT_HOST, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(1, mockPageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(1, mockPageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, mockPageFaultManager->memoryData[ptrSVM].domain);
+
+    context->memoryManager = memoryManager;
+}
+
+HWTEST_F(EnqueueSvmTest, givenPrefetchMigrationEnabledWhenEnqueueSvmMigrateMemThenQueueIsWaitedBeforeAllocIsMoved) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableUsmPrefetchMigration.set(1);
+
+    auto mockMemoryManager = std::make_unique<MockMemoryManager>();
+    auto mockPageFaultManager = new MockPageFaultManager();
+    mockMemoryManager->pageFaultManager.reset(mockPageFaultManager);
+    auto memoryManager = context->getMemoryManager();
+    context->memoryManager = mockMemoryManager.get();
+    mockPageFaultManager->insertAllocation(ptrSVM, 256, context->getSVMAllocsManager(), context->getSpecialQueue(0u), {});
+    mockPageFaultManager->moveAllocationToGpuDomain(ptrSVM);
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto waitCalled = csr.waitForCompletionWithTimeoutTaskCountCalled.load();
+
+    const void *svmPtrs[] = {ptrSVM};
+    retVal = pCmdQ->enqueueSVMMigrateMem(1, svmPtrs, nullptr, CL_MIGRATE_MEM_OBJECT_HOST, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_LT(waitCalled, csr.waitForCompletionWithTimeoutTaskCountCalled.load());
+    EXPECT_EQ(pCmdQ->taskCount, csr.latestWaitForCompletionWithTimeoutTaskCount.load());
+    EXPECT_EQ(1, mockPageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, mockPageFaultManager->memoryData[ptrSVM].domain);
+
+    context->memoryManager = memoryManager;
+}
+
+TEST_F(EnqueueSvmTest, givenPrefetchMigrationEnabledAndBlockedWaitListWhenEnqueueSvmMigrateMemThenAllocIsNotMoved) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableUsmPrefetchMigration.set(1);
+
+    auto mockMemoryManager = std::make_unique<MockMemoryManager>();
+    auto mockPageFaultManager = new MockPageFaultManager();
+    mockMemoryManager->pageFaultManager.reset(mockPageFaultManager);
+    auto memoryManager = context->getMemoryManager();
+    context->memoryManager = mockMemoryManager.get();
+    mockPageFaultManager->insertAllocation(ptrSVM, 256, context->getSVMAllocsManager(), context->getSpecialQueue(0u), {});
+    mockPageFaultManager->moveAllocationToGpuDomain(ptrSVM);
+
+    auto uEvent = make_releaseable<UserEvent>();
+    cl_event eventWaitList[] = {uEvent.get()};
+    const void *svmPtrs[] = {ptrSVM};
+    retVal = pCmdQ->enqueueSVMMigrateMem(1, svmPtrs, nullptr, CL_MIGRATE_MEM_OBJECT_HOST, 1, eventWaitList, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(0, mockPageFaultManager->transferToCpuCalled);
+
+    uEvent->setStatus(CL_COMPLETE);
+    EXPECT_EQ(0, mockPageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Gpu, mockPageFaultManager->memoryData[ptrSVM].domain);
+
+    context->memoryManager = memoryManager;
+}
+
+TEST_F(EnqueueSvmTest, givenPrefetchMigrationDisabledWhenEnqueueSvmMigrateMemThenAllocIsNotMoved) {
+    auto mockMemoryManager = std::make_unique<MockMemoryManager>();
+    auto mockPageFaultManager = new MockPageFaultManager();
+    mockMemoryManager->pageFaultManager.reset(mockPageFaultManager);
+    auto memoryManager = context->getMemoryManager();
+    context->memoryManager = mockMemoryManager.get();
+    mockPageFaultManager->insertAllocation(ptrSVM, 256, context->getSVMAllocsManager(), context->getSpecialQueue(0u), {});
+
+    const void *svmPtrs[] = {ptrSVM};
+    retVal = pCmdQ->enqueueSVMMigrateMem(1, svmPtrs, nullptr, 0, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(0, mockPageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, mockPageFaultManager->memoryData[ptrSVM].domain);
+
+    context->memoryManager = memoryManager;
+}
+
 HWTEST_F(EnqueueSvmTest, givenCopyFromMappedPtrToSvmAllocWhenCallingSvmMemcpyThenReuseMappedAllocations) {
     constexpr size_t size = 1u;
     auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
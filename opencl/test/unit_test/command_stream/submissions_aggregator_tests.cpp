@@ -7,6 +7,7 @@
 
 #include "shared/source/command_stream/submissions_aggregator.h"
 #include "shared/source/helpers/flush_stamp.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_csr.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
@@ -709,3 +710,132 @@ HWTEST_F(SubmissionsAggregatorTests, givenMultipleCmdBuffersWhenNotAggregatedDur
     castToObject<Event>(event1)->release();
     castToObject<Event>(event2)->release();
 }
+
+TEST(SubmissionsAggregator, givenNoFlushThresholdsWhenCommandBuffersAreRecordedThenThresholdIsNotReached) {
+    MockSubmissionAggregator submissionsAggregator;
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+
+    EXPECT_FALSE(submissionsAggregator.isFlushThresholdReached(std::chrono::steady_clock::now()));
+
+    for (auto i = 0u; i < 16u; i++) {
+        CommandBuffer *cmdBuffer = new CommandBuffer(*device);
+        cmdBuffer->batchBuffer.usedSize = MemoryConstants::pageSize;
+        submissionsAggregator.recordCommandBuffer(cmdBuffer);
+    }
+    EXPECT_EQ(16u, submissionsAggregator.peekRecordedCommandBuffersCount());
+    EXPECT_EQ(16u * MemoryConstants::pageSize, submissionsAggregator.peekRecordedBytes());
+    EXPECT_FALSE(submissionsAggregator.isFlushThresholdReached(std::chrono::steady_clock::now() + std::chrono::hours(1)));
+}
+
+TEST(SubmissionsAggregator, givenCommandBuffersCountThresholdWhenCountIsReachedThenThresholdIsReported) {
+    MockSubmissionAggregator submissionsAggregator;
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    submissionsAggregator.setFlushThresholds(2u, 0u, std::chrono::microseconds(0));
+
+    submissionsAggregator.recordCommandBuffer(new CommandBuffer(*device));
+    EXPECT_FALSE(submissionsAggregator.isFlushThresholdReached(std::chrono::steady_clock::now()));
+
+    submissionsAggregator.recordCommandBuffer(new CommandBuffer(*device));
+    EXPECT_TRUE(submissionsAggregator.isFlushThresholdReached(std::chrono::steady_clock::now()));
+
+    submissionsAggregator.peekCommandBuffersList().deleteAll();
+    EXPECT_FALSE(submissionsAggregator.isFlushThresholdReached(std::chrono::steady_clock::now()));
+
+    submissionsAggregator.recordCommandBuffer(new CommandBuffer(*device));
+    EXPECT_EQ(1u, submissionsAggregator.peekRecordedCommandBuffersCount());
+    EXPECT_FALSE(submissionsAggregator.isFlushThresholdReached(std::chrono::steady_clock::now()));
+}
+
+TEST(SubmissionsAggregator, givenBytesThresholdWhenRecordedCommandsExceedItThenThresholdIsReported) {
+    MockSubmissionAggregator submissionsAggregator;
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    submissionsAggregator.setFlushThresholds(0u, MemoryConstants::pageSize, std::chrono::microseconds(0));
+
+    CommandBuffer *cmdBuffer = new CommandBuffer(*device);
+    cmdBuffer->batchBuffer.startOffset = MemoryConstants::pageSize;
+    cmdBuffer->batchBuffer.usedSize = MemoryConstants::pageSize + 64u;
+    submissionsAggregator.recordCommandBuffer(cmdBuffer);
+    EXPECT_EQ(64u, submissionsAggregator.peekRecordedBytes());
+    EXPECT_FALSE(submissionsAggregator.isFlushThresholdReached(std::chrono::steady_clock::now()));
+
+    cmdBuffer = new CommandBuffer(*device);
+    cmdBuffer->batchBuffer.usedSize = MemoryConstants::pageSize;
+    submissionsAggregator.recordCommandBuffer(cmdBuffer);
+    EXPECT_TRUE(submissionsAggregator.isFlushThresholdReached(std::chrono::steady_clock::now()));
+}
+
+TEST(SubmissionsAggregator, givenDelayThresholdWhenOldestCommandBufferWaitsLongerThenThresholdIsReported) {
+    MockSubmissionAggregator submissionsAggregator;
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    submissionsAggregator.setFlushThresholds(0u, 0u, std::chrono::microseconds(100));
+
+    submissionsAggregator.recordCommandBuffer(new CommandBuffer(*device));
+    auto recordTime = std::chrono::steady_clock::now();
+
+    EXPECT_FALSE(submissionsAggregator.isFlushThresholdReached(recordTime - std::chrono::microseconds(1)));
+    EXPECT_TRUE(submissionsAggregator.isFlushThresholdReached(recordTime + std::chrono::microseconds(100)));
+}
+
+HWTEST_F(SubmissionsAggregatorTests, givenBatchedDispatchWithCommandBuffersThresholdWhenThresholdIsReachedThenSubmissionsAreFlushed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BatchedDispatchMaxCommandBuffers.set(2);
+
+    MockKernelWithInternals kernel(*device.get());
+    CommandQueueHw<FamilyType> cmdQ(context.get(), device.get(), 0, false);
+    auto mockCsr = new MockCsrHw2<FamilyType>(*device->executionEnvironment, device->getRootDeviceIndex(), device->getDeviceBitfield());
+    size_t GWS = 1;
+
+    overrideCsr(mockCsr);
+
+    cmdQ.enqueueKernel(kernel, 1, nullptr, &GWS, nullptr, 0, nullptr, nullptr);
+    EXPECT_FALSE(mockCsr->peekSubmissionAggregator()->peekCmdBufferList().peekIsEmpty());
+
+    cmdQ.enqueueKernel(kernel, 1, nullptr, &GWS, nullptr, 0, nullptr, nullptr);
+    EXPECT_TRUE(mockCsr->peekSubmissionAggregator()->peekCmdBufferList().peekIsEmpty());
+}
+
+HWTEST_F(SubmissionsAggregatorTests, givenBatchedDispatchWithDelayThresholdWhenPollingEventStatusOfAgedSubmissionThenSubmissionsAreFlushed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BatchedDispatchMaxDelayUs.set(1);
+
+    MockKernelWithInternals kernel(*device.get());
+    CommandQueueHw<FamilyType> cmdQ(context.get(), device.get(), 0, false);
+    auto mockCsr = new MockCsrHw2<FamilyType>(*device->executionEnvironment, device->getRootDeviceIndex(), device->getDeviceBitfield());
+    size_t GWS = 1;
+
+    overrideCsr(mockCsr);
+    *mockCsr->getTagAddress() = 0u;
+
+    cl_event event;
+    cmdQ.enqueueKernel(kernel, 1, nullptr, &GWS, nullptr, 0, nullptr, &event);
+    EXPECT_FALSE(mockCsr->peekSubmissionAggregator()->peekCmdBufferList().peekIsEmpty());
+
+    auto recordTime = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - recordTime < std::chrono::microseconds(2)) {
+    }
+
+    EXPECT_EQ(CL_SUBMITTED, castToObject<Event>(event)->updateEventAndReturnCurrentStatus());
+    EXPECT_TRUE(mockCsr->peekSubmissionAggregator()->peekCmdBufferList().peekIsEmpty());
+
+    *mockCsr->getTagAddress() = mockCsr->peekTaskCount();
+    castToObject<Event>(event)->release();
+}
+
+HWTEST_F(SubmissionsAggregatorTests, givenBatchedDispatchWithoutDelayThresholdWhenPollingEventStatusThenSubmissionsAreNotFlushed) {
+    MockKernelWithInternals kernel(*device.get());
+    CommandQueueHw<FamilyType> cmdQ(context.get(), device.get(), 0, false);
+    auto mockCsr = new MockCsrHw2<FamilyType>(*device->executionEnvironment, device->getRootDeviceIndex(), device->getDeviceBitfield());
+    size_t GWS = 1;
+
+    overrideCsr(mockCsr);
+    *mockCsr->getTagAddress() = 0u;
+
+    cl_event event;
+    cmdQ.enqueueKernel(kernel, 1, nullptr, &GWS, nullptr, 0, nullptr, &event);
+
+    EXPECT_EQ(CL_SUBMITTED, castToObject<Event>(event)->updateEventAndReturnCurrentStatus());
+    EXPECT_FALSE(mockCsr->peekSubmissionAggregator()->peekCmdBufferList().peekIsEmpty());
+
+    *mockCsr->getTagAddress() = mockCsr->peekTaskCount();
+    castToObject<Event>(event)->release();
+}
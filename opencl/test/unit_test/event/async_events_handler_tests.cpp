@@ -332,6 +332,81 @@ TEST_F(AsyncEventsHandlerTests, givenRegistredEventsWhenProcessIsCalledThenRetur
     event3->setStatus(CL_COMPLETE);
 }
 
+TEST_F(AsyncEventsHandlerTests, givenEventsWithNotReachedTaskCountWhenProcessedThenEventsAreMovedToCompletionBucket) {
+    int event1Counter(0), event2Counter(0);
+    auto tagAddress = commandQueue->getGpgpuCommandStreamReceiver().getTagAddress();
+
+    event1->setTaskStamp(0, 1);
+    event2->setTaskStamp(0, 2);
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &event1Counter);
+    event2->addCallback(&this->callbackFcn, CL_COMPLETE, &event2Counter);
+    handler->registerEvent(event2.get());
+    handler->registerEvent(event1.get());
+
+    auto sleepCandidate = handler->process();
+    EXPECT_EQ(event1.get(), sleepCandidate);
+    EXPECT_EQ(1u, handler->completionBuckets.size());
+    EXPECT_EQ(2u, handler->peekCompletionBucketEventsCount());
+    EXPECT_EQ(CL_SUBMITTED, event1->getExecutionStatus());
+    EXPECT_EQ(CL_SUBMITTED, event2->getExecutionStatus());
+
+    *tagAddress = 1;
+    sleepCandidate = handler->process();
+    EXPECT_EQ(event2.get(), sleepCandidate);
+    EXPECT_EQ(1u, handler->peekCompletionBucketEventsCount());
+    EXPECT_EQ(1, event1Counter);
+    EXPECT_EQ(0, event2Counter);
+    EXPECT_EQ(1, event1->getRefInternalCount());
+
+    *tagAddress = 2;
+    sleepCandidate = handler->process();
+    EXPECT_EQ(nullptr, sleepCandidate);
+    EXPECT_EQ(0u, handler->peekCompletionBucketEventsCount());
+    EXPECT_EQ(1, event2Counter);
+    EXPECT_TRUE(handler->peekIsListEmpty());
+}
+
+TEST_F(AsyncEventsHandlerTests, givenEventWithNotReachedTaskCountWhenTagIsNotUpdatedThenEventIsNotProcessedAgain) {
+    struct CountingEvent : public MyEvent {
+        using MyEvent::MyEvent;
+        void updateExecutionStatus() override {
+            updateCalled++;
+            MyEvent::updateExecutionStatus();
+        }
+        uint32_t updateCalled = 0u;
+    };
+    auto event = make_releaseable<CountingEvent>(context.get(), commandQueue.get(), CL_COMMAND_BARRIER, CompletionStamp::notReady, CompletionStamp::notReady);
+    event->setTaskStamp(0, 5);
+    event->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+    handler->registerEvent(event.get());
+
+    handler->process();
+    EXPECT_EQ(1u, event->updateCalled);
+    handler->process();
+    handler->process();
+    EXPECT_EQ(1u, event->updateCalled);
+    EXPECT_EQ(1u, handler->peekCompletionBucketEventsCount());
+
+    event->setStatus(CL_COMPLETE);
+    EXPECT_EQ(1, counter);
+}
+
+TEST_F(AsyncEventsHandlerTests, givenEventsInCompletionBucketWhenAsyncExecutionInterruptedThenUnreferenceAll) {
+    event1->setTaskStamp(0, 1);
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+    handler->registerEvent(event1.get());
+    handler->process();
+    EXPECT_EQ(1u, handler->peekCompletionBucketEventsCount());
+    EXPECT_EQ(3, event1->getRefInternalCount());
+
+    handler->allowAsyncProcess.store(false);
+    MockHandler::asyncProcess(handler.get());
+    EXPECT_TRUE(handler->peekIsListEmpty());
+    EXPECT_EQ(2, event1->getRefInternalCount());
+
+    event1->setStatus(CL_COMPLETE);
+}
+
 TEST_F(AsyncEventsHandlerTests, givenEventWithoutCallbacksWhenProcessedThenDontReturnAsSleepCandidate) {
     event1->setTaskStamp(0, 1);
     event2->setTaskStamp(0, 2);
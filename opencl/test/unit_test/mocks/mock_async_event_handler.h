@@ -25,6 +25,7 @@ class MockHandler : public AsyncEventsHandler {
     using AsyncEventsHandler::allowAsyncProcess;
     using AsyncEventsHandler::asyncMtx;
     using AsyncEventsHandler::asyncProcess;
+    using AsyncEventsHandler::completionBuckets;
     using AsyncEventsHandler::openThread;
     using AsyncEventsHandler::thread;
 
@@ -59,7 +60,14 @@ class MockHandler : public AsyncEventsHandler {
         openThreadCalled = true;
     }
 
-    bool peekIsListEmpty() { return list.size() == 0; }
+    bool peekIsListEmpty() { return list.size() == 0 && completionBuckets.empty(); }
+    size_t peekCompletionBucketEventsCount() {
+        size_t count = 0;
+        for (auto &bucket : completionBuckets) {
+            count += bucket.second.size();
+        }
+        return count;
+    }
     bool peekIsRegisterListEmpty() { return registerList.size() == 0; }
     std::atomic<int> transferCounter;
     bool openThreadCalled = false;
@@ -35,6 +35,7 @@ class MockCommandQueue : public CommandQueue {
     using CommandQueue::queueFamilySelected;
     using CommandQueue::queueIndexWithinFamily;
     using CommandQueue::requiresCacheFlushAfterWalker;
+    using CommandQueue::splitBcsEngineTypes;
     using CommandQueue::throttle;
     using CommandQueue::timestampPacketContainer;
 
@@ -7,6 +7,7 @@
 
 #include "opencl/test/unit_test/utilities/file_logger_tests.h"
 
+#include "shared/source/utilities/binary_log_writer.h"
 #include "shared/source/utilities/logger.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/unit_test/utilities/base_object_utils.h"
@@ -70,6 +71,30 @@ TEST(FileLogger, GivenEnabledDebugFunctinalityWhenLoggingApiCallsThenDumpToFile)
     }
 }
 
+TEST(FileLogger, GivenBinaryApiLoggingEnabledWhenLoggingApiCallsThenTextIsNotFormattedAndBinaryFileIsWritten) {
+    DebugVariables flags;
+    flags.LogApiCalls.set(true);
+    flags.LogApiCallsBinary.set(true);
+    std::string logFileName("test_binary.log");
+    {
+        FullyEnabledFileLogger fileLogger(logFileName, flags);
+
+        fileLogger.logApiCall("searchString", true, 0);
+        fileLogger.logApiCall("searchString", false, 0);
+
+        EXPECT_FALSE(fileLogger.wasFileCreated(fileLogger.getLogFileName()));
+        fileLogger.setLogFileName("");
+    }
+
+    size_t fileSize = 0u;
+    auto data = loadDataFromFile(logFileName.c_str(), fileSize);
+    std::remove(logFileName.c_str());
+
+    ASSERT_LT(sizeof(BinaryLog::fileMagic), fileSize);
+    EXPECT_EQ(0, memcmp(data.get(), BinaryLog::fileMagic, sizeof(BinaryLog::fileMagic)));
+    EXPECT_NE(std::string::npos, std::string(data.get(), fileSize).find("searchString"));
+}
+
 TEST(FileLogger, GivenDisabledDebugFunctinalityWhenLoggingApiCallsThenFileIsNotCreated) {
     DebugVariables flags;
     flags.LogApiCalls.set(true);
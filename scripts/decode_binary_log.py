@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+
+#
+# Copyright (C) 2021 Intel Corporation
+#
+# SPDX-License-Identifier: MIT
+#
+
+# Converts a log written with LogApiCalls=1 and LogApiCallsBinary=1 to text.
+# Record layout is described in shared/source/utilities/binary_log_writer.h.
+
+import struct
+import sys
+
+FILE_MAGIC = b"NEOBLOG\0"
+FILE_VERSION = 1
+RECORD_HEADER = struct.Struct("<HHIQ")
+
+THREAD_START = 0
+STRING = 1
+API_ENTER = 2
+API_LEAVE = 3
+TEXT = 4
+DROPPED = 5
+
+
+def read_records(data):
+    offset = len(FILE_MAGIC) + 4
+    while offset + RECORD_HEADER.size <= len(data):
+        record_type, payload_size, thread_index, timestamp = RECORD_HEADER.unpack_from(data, offset)
+        offset += RECORD_HEADER.size
+        payload = data[offset:offset + payload_size]
+        offset += payload_size
+        yield record_type, thread_index, timestamp, payload
+
+
+def decode(data, out):
+    if data[:len(FILE_MAGIC)] != FILE_MAGIC:
+        raise ValueError("not a binary log file")
+    version, = struct.unpack_from("<I", data, len(FILE_MAGIC))
+    if version != FILE_VERSION:
+        raise ValueError("unsupported binary log version %d" % version)
+
+    strings = {}
+    thread_ids = {}
+    records = []
+    for record_type, thread_index, timestamp, payload in read_records(data):
+        if record_type == THREAD_START:
+            thread_ids[thread_index], = struct.unpack_from("<Q", payload)
+        elif record_type == STRING:
+            string_id, = struct.unpack_from("<I", payload)
+            strings[(thread_index, string_id)] = payload[4:].decode("utf-8", "replace")
+        else:
+            # a buffer released by an exiting thread is reused by the next one, which starts with its own ThreadStart
+            records.append((timestamp, thread_index, thread_ids.get(thread_index, thread_index), record_type, payload))
+
+    # buffers of different threads are flushed in chunks, restore the global order
+    records.sort(key=lambda record: (record[0], record[1]))
+
+    for timestamp, thread_index, thread_id, record_type, payload in records:
+        prefix = "[%d.%09d] ThreadID: %x " % (timestamp // 1000000000, timestamp % 1000000000, thread_id)
+        if record_type == API_ENTER:
+            string_id, = struct.unpack_from("<I", payload)
+            out.write(prefix + "Function Enter: %s\n" % strings.get((thread_index, string_id), "<unknown>"))
+        elif record_type == API_LEAVE:
+            string_id, error_code = struct.unpack_from("<Ii", payload)
+            out.write(prefix + "Function Leave (%d): %s\n" % (error_code, strings.get((thread_index, string_id), "<unknown>")))
+        elif record_type == TEXT:
+            out.write(payload.decode("utf-8", "replace"))
+        elif record_type == DROPPED:
+            dropped, = struct.unpack_from("<Q", payload)
+            out.write(prefix + "%d records dropped\n" % dropped)
+
+
+def main():
+    if len(sys.argv) < 2:
+        print("usage: %s <binary log file> [output file]" % sys.argv[0])
+        return 1
+    with open(sys.argv[1], "rb") as f:
+        data = f.read()
+    if len(sys.argv) > 2:
+        with open(sys.argv[2], "w") as out:
+            decode(data, out)
+    else:
+        decode(data, sys.stdout)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
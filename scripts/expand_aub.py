@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+
+#
+# Copyright (C) 2021 Intel Corporation
+#
+# SPDX-License-Identifier: MIT
+#
+
+# Expands an AUB file written with AubDumpCompression=1 back to a standard AUB file.
+# Block layout is described in shared/source/aub_mem_dump/aub_compressed_file_writer.h.
+
+import struct
+import sys
+
+FILE_MAGIC = b"NEOAUBZ\0"
+FILE_VERSION = 1
+BLOCK_HEADER = struct.Struct("<III")
+
+CODEC_STORED = 0
+CODEC_DWORD_RLE = 1
+
+RUN_TOKEN_BIT = 0x80000000
+RUN_COUNT_MASK = 0x7fffffff
+
+
+def expand_dword_rle(stored, raw_size):
+    tail_size = raw_size % 4
+    tokens_size = len(stored) - tail_size
+    out = bytearray()
+    offset = 0
+    while offset < tokens_size:
+        token, = struct.unpack_from("<I", stored, offset)
+        offset += 4
+        count = token & RUN_COUNT_MASK
+        if token & RUN_TOKEN_BIT:
+            out += stored[offset:offset + 4] * count
+            offset += 4
+        else:
+            out += stored[offset:offset + count * 4]
+            offset += count * 4
+    out += stored[tokens_size:]
+    if offset != tokens_size or len(out) != raw_size:
+        raise ValueError("corrupted block")
+    return out
+
+
+def expand(src, dst):
+    header = src.read(len(FILE_MAGIC) + 4)
+    if header[:len(FILE_MAGIC)] != FILE_MAGIC:
+        raise ValueError("not a compressed AUB file")
+    version, = struct.unpack_from("<I", header, len(FILE_MAGIC))
+    if version != FILE_VERSION:
+        raise ValueError("unsupported compressed AUB version %d" % version)
+
+    while True:
+        block_header = src.read(BLOCK_HEADER.size)
+        if not block_header:
+            break
+        if len(block_header) != BLOCK_HEADER.size:
+            raise ValueError("truncated block header")
+        codec, raw_size, stored_size = BLOCK_HEADER.unpack(block_header)
+        stored = src.read(stored_size)
+        if len(stored) != stored_size:
+            raise ValueError("truncated block")
+        if codec == CODEC_STORED:
+            dst.write(stored)
+        elif codec == CODEC_DWORD_RLE:
+            dst.write(expand_dword_rle(stored, raw_size))
+        else:
+            raise ValueError("unknown block codec %d" % codec)
+
+
+def main():
+    if len(sys.argv) != 3:
+        print("usage: %s <compressed aub file> <output aub file>" % sys.argv[0])
+        return 1
+    with open(sys.argv[1], "rb") as src, open(sys.argv[2], "wb") as dst:
+        expand(src, dst)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
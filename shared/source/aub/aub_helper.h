@@ -38,6 +38,20 @@ class AubHelper : public NonCopyableOrMovableClass {
         }
     }
 
+    static bool isGpuReadOnlyAllocationType(const GraphicsAllocation::AllocationType &type) {
+        switch (type) {
+        case GraphicsAllocation::AllocationType::COMMAND_BUFFER:
+        case GraphicsAllocation::AllocationType::CONSTANT_SURFACE:
+        case GraphicsAllocation::AllocationType::INTERNAL_HEAP:
+        case GraphicsAllocation::AllocationType::KERNEL_ISA:
+        case GraphicsAllocation::AllocationType::KERNEL_ISA_INTERNAL:
+        case GraphicsAllocation::AllocationType::LINEAR_STREAM:
+            return true;
+        default:
+            return false;
+        }
+    }
+
     static uint64_t getTotalMemBankSize();
     static int getMemTrace(uint64_t pdEntryBits);
     static uint64_t getPTEntryBits(uint64_t pdEntryBits);
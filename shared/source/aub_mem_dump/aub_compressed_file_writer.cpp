@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/aub_mem_dump/aub_compressed_file_writer.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <cstring>
+#include <istream>
+#include <ostream>
+
+namespace AubMemDump {
+
+namespace CompressedAub {
+namespace {
+constexpr size_t minRunLength = 3u;
+
+void appendDwords(std::vector<char> &dst, const void *src, size_t count) {
+    auto bytes = reinterpret_cast<const char *>(src);
+    dst.insert(dst.end(), bytes, bytes + count * sizeof(uint32_t));
+}
+
+void appendLiterals(std::vector<char> &dst, const char *data, size_t first, size_t last) {
+    if (first == last) {
+        return;
+    }
+    auto token = static_cast<uint32_t>(last - first);
+    appendDwords(dst, &token, 1u);
+    appendDwords(dst, data + first * sizeof(uint32_t), last - first);
+}
+
+uint32_t readDword(const char *data, size_t index) {
+    uint32_t value = 0u;
+    memcpy(&value, data + index * sizeof(uint32_t), sizeof(value));
+    return value;
+}
+} // namespace
+
+BlockCodec compressBlock(const char *data, size_t size, std::vector<char> &compressed) {
+    compressed.clear();
+    auto dwordCount = size / sizeof(uint32_t);
+
+    size_t literalStart = 0u;
+    size_t position = 0u;
+    while (position < dwordCount) {
+        auto value = readDword(data, position);
+        auto runEnd = position + 1;
+        while (runEnd < dwordCount && runEnd - position < runCountMask && readDword(data, runEnd) == value) {
+            runEnd++;
+        }
+        if (runEnd - position >= minRunLength) {
+            appendLiterals(compressed, data, literalStart, position);
+            uint32_t run[2] = {runTokenBit | static_cast<uint32_t>(runEnd - position), value};
+            appendDwords(compressed, run, 2u);
+            literalStart = runEnd;
+        }
+        position = runEnd;
+        if (compressed.size() >= size) {
+            break;
+        }
+    }
+    appendLiterals(compressed, data, literalStart, dwordCount);
+    compressed.insert(compressed.end(), data + dwordCount * sizeof(uint32_t), data + size);
+
+    if (compressed.size() >= size) {
+        compressed.assign(data, data + size);
+        return BlockCodec::Stored;
+    }
+    return BlockCodec::DwordRle;
+}
+
+bool expandBlock(BlockCodec codec, const char *data, size_t storedSize, size_t rawSize, std::vector<char> &expanded) {
+    expanded.clear();
+    if (codec == BlockCodec::Stored) {
+        expanded.assign(data, data + storedSize);
+        return storedSize == rawSize;
+    }
+    if (codec != BlockCodec::DwordRle) {
+        return false;
+    }
+
+    expanded.reserve(rawSize);
+    auto dwordBytes = rawSize - rawSize % sizeof(uint32_t);
+    auto tailSize = rawSize - dwordBytes;
+    if (storedSize < tailSize) {
+        return false;
+    }
+    auto tokensSize = storedSize - tailSize;
+    size_t offset = 0u;
+    while (offset + sizeof(uint32_t) <= tokensSize && expanded.size() < dwordBytes) {
+        auto token = readDword(data + offset, 0u);
+        offset += sizeof(uint32_t);
+        auto count = static_cast<size_t>(token & runCountMask);
+        if (expanded.size() + count * sizeof(uint32_t) > dwordBytes) {
+            return false;
+        }
+        if (token & runTokenBit) {
+            if (offset + sizeof(uint32_t) > tokensSize) {
+                return false;
+            }
+            for (size_t i = 0; i < count; i++) {
+                expanded.insert(expanded.end(), data + offset, data + offset + sizeof(uint32_t));
+            }
+            offset += sizeof(uint32_t);
+        } else {
+            if (offset + count * sizeof(uint32_t) > tokensSize) {
+                return false;
+            }
+            expanded.insert(expanded.end(), data + offset, data + offset + count * sizeof(uint32_t));
+            offset += count * sizeof(uint32_t);
+        }
+    }
+    if (offset != tokensSize || expanded.size() != dwordBytes) {
+        return false;
+    }
+    expanded.insert(expanded.end(), data + tokensSize, data + storedSize);
+    return true;
+}
+
+bool expand(std::istream &input, std::ostream &output) {
+    char magic[sizeof(fileMagic)] = {};
+    uint32_t version = 0u;
+    input.read(magic, sizeof(magic));
+    input.read(reinterpret_cast<char *>(&version), sizeof(version));
+    if (!input || memcmp(magic, fileMagic, sizeof(fileMagic)) != 0 || version != fileVersion) {
+        return false;
+    }
+
+    std::vector<char> stored;
+    std::vector<char> expanded;
+    BlockHeader header = {};
+    while (input.read(reinterpret_cast<char *>(&header), sizeof(header))) {
+        stored.resize(header.storedSize);
+        if (!input.read(stored.data(), stored.size())) {
+            return false;
+        }
+        if (!expandBlock(static_cast<BlockCodec>(header.codec), stored.data(), stored.size(), header.rawSize, expanded)) {
+            return false;
+        }
+        output.write(expanded.data(), expanded.size());
+    }
+    return input.gcount() == 0 && static_cast<bool>(output);
+}
+} // namespace CompressedAub
+
+AubCompressedFileWriter::AubCompressedFileWriter(std::ostream &output, size_t blockSize)
+    : output(output), blockSize(blockSize) {
+    output.write(CompressedAub::fileMagic, sizeof(CompressedAub::fileMagic));
+    output.write(reinterpret_cast<const char *>(&CompressedAub::fileVersion), sizeof(CompressedAub::fileVersion));
+    currentBlock.reserve(blockSize);
+    thread = NEO::Thread::create(compressionThread, reinterpret_cast<void *>(this));
+}
+
+AubCompressedFileWriter::~AubCompressedFileWriter() {
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        keepRunning = false;
+    }
+    blocksAvailable.notify_all();
+    if (thread) {
+        thread->join();
+        thread.reset();
+    }
+}
+
+void AubCompressedFileWriter::write(const char *data, size_t size) {
+    while (size > 0u) {
+        auto chunkSize = std::min(size, blockSize - currentBlock.size());
+        currentBlock.insert(currentBlock.end(), data, data + chunkSize);
+        data += chunkSize;
+        size -= chunkSize;
+        if (currentBlock.size() == blockSize) {
+            submitCurrentBlock();
+        }
+    }
+}
+
+void AubCompressedFileWriter::flush() {
+    if (!currentBlock.empty()) {
+        submitCurrentBlock();
+    }
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        blocksConsumed.wait(lock, [this] { return pendingBlocks.empty() && !writingBlock; });
+    }
+    output.flush();
+}
+
+void AubCompressedFileWriter::submitCurrentBlock() {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        // bounds memory use when the stream is produced faster than it is compressed
+        blocksConsumed.wait(lock, [this] { return pendingBlocks.size() < maxPendingBlocks; });
+        pendingBlocks.push_back(std::move(currentBlock));
+    }
+    blocksAvailable.notify_one();
+    currentBlock = std::vector<char>();
+    currentBlock.reserve(blockSize);
+}
+
+void AubCompressedFileWriter::writeBlock(const std::vector<char> &block) {
+    std::vector<char> compressed;
+    auto codec = CompressedAub::compressBlock(block.data(), block.size(), compressed);
+
+    CompressedAub::BlockHeader header = {};
+    header.codec = static_cast<uint32_t>(codec);
+    header.rawSize = static_cast<uint32_t>(block.size());
+    header.storedSize = static_cast<uint32_t>(compressed.size());
+    output.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    output.write(compressed.data(), compressed.size());
+}
+
+void *AubCompressedFileWriter::compressionThread(void *self) {
+    auto writer = reinterpret_cast<AubCompressedFileWriter *>(self);
+    std::unique_lock<std::mutex> lock(writer->mutex);
+    while (true) {
+        writer->blocksAvailable.wait(lock, [writer] { return !writer->pendingBlocks.empty() || !writer->keepRunning; });
+        if (writer->pendingBlocks.empty()) {
+            break;
+        }
+        auto block = std::move(writer->pendingBlocks.front());
+        writer->pendingBlocks.pop_front();
+        writer->writingBlock = true;
+        lock.unlock();
+
+        writer->writeBlock(block);
+
+        lock.lock();
+        writer->writingBlock = false;
+        writer->blocksConsumed.notify_all();
+    }
+    return nullptr;
+}
+
+} // namespace AubMemDump
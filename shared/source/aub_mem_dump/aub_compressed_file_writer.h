@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+}
+
+namespace AubMemDump {
+
+// Compressed AUB container:
+//   char[8] fileMagic, uint32_t fileVersion, then blocks of BlockHeader followed by storedSize bytes.
+// Concatenating the expanded blocks gives the standard AUB file, see scripts/expand_aub.py.
+namespace CompressedAub {
+constexpr char fileMagic[8] = "NEOAUBZ";
+constexpr uint32_t fileVersion = 1u;
+
+enum class BlockCodec : uint32_t {
+    Stored = 0,
+    // uint32_t tokens: bit 31 set - (token & runCountMask) copies of the following dword,
+    // bit 31 clear - token literal dwords follow; rawSize % 4 trailing bytes are stored verbatim
+    DwordRle = 1,
+};
+
+constexpr uint32_t runTokenBit = 0x80000000u;
+constexpr uint32_t runCountMask = 0x7fffffffu;
+
+#pragma pack(push, 1)
+struct BlockHeader {
+    uint32_t codec;
+    uint32_t rawSize;
+    uint32_t storedSize;
+};
+#pragma pack(pop)
+static_assert(sizeof(BlockHeader) == 12, "");
+
+BlockCodec compressBlock(const char *data, size_t size, std::vector<char> &compressed);
+bool expandBlock(BlockCodec codec, const char *data, size_t storedSize, size_t rawSize, std::vector<char> &expanded);
+bool expand(std::istream &input, std::ostream &output);
+} // namespace CompressedAub
+
+// Collects AUB stream writes into blocks which are compressed and written to the output by a background thread.
+class AubCompressedFileWriter : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t defaultBlockSize = 1024 * 1024;
+    static constexpr size_t maxPendingBlocks = 4u;
+
+    AubCompressedFileWriter(std::ostream &output, size_t blockSize);
+    ~AubCompressedFileWriter();
+
+    void write(const char *data, size_t size);
+    void flush();
+
+  protected:
+    void submitCurrentBlock();
+    void writeBlock(const std::vector<char> &block);
+    static void *compressionThread(void *self);
+
+    std::ostream &output;
+    const size_t blockSize;
+    std::vector<char> currentBlock;
+
+    std::deque<std::vector<char>> pendingBlocks;
+    bool writingBlock = false;
+    bool keepRunning = true;
+    std::mutex mutex;
+    std::condition_variable blocksAvailable;
+    std::condition_variable blocksConsumed;
+    std::unique_ptr<NEO::Thread> thread;
+};
+
+} // namespace AubMemDump
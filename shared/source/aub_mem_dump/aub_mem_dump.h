@@ -9,8 +9,10 @@
 #include "shared/source/aub_mem_dump/aub_data.h"
 
 #include <fstream>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 
 namespace NEO {
 class AubHelper;
@@ -19,6 +21,8 @@ class AubHelper;
 namespace AubMemDump {
 #include "aub_services.h"
 
+class AubCompressedFileWriter;
+
 constexpr uint32_t rcsRegisterBase = 0x2000;
 
 #ifndef BIT
@@ -120,6 +124,7 @@ struct AubStream {
 };
 
 struct AubFileStream : public AubStream {
+    ~AubFileStream() override;
     void open(const char *filePath) override;
     void close() override;
     bool init(uint32_t stepping, uint32_t device) override;
@@ -139,10 +144,22 @@ struct AubFileStream : public AubStream {
                                        uint32_t addressSpace, uint32_t compareOperation);
     MOCKABLE_VIRTUAL bool addComment(const char *message);
     MOCKABLE_VIRTUAL std::unique_lock<std::mutex> lockStream();
+    bool isSkippingUnchangedPages() const { return skipUnchangedPages; }
+    void invalidatePageHashes(uint64_t physAddress, size_t size, uint32_t addressSpace);
 
     std::ofstream fileHandle;
     std::string fileName;
     std::mutex mutex;
+
+  protected:
+    void writeMemoryBlock(uint64_t physAddress, const void *memory, size_t size, uint32_t addressSpace, uint32_t hint);
+    void writeMemoryWriteHeaderImpl(uint64_t physAddress, size_t size, uint32_t addressSpace, uint32_t hint);
+    bool updatePageHash(uint64_t physAddress, const void *memory, uint32_t addressSpace);
+
+    // content hash of the last write of each full page, keyed by page address | address space
+    bool skipUnchangedPages = false;
+    std::unordered_map<uint64_t, uint64_t> pageHashes;
+    std::unique_ptr<AubCompressedFileWriter> compressedWriter;
 };
 
 template <int addressingBits>
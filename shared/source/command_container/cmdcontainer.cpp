@@ -64,7 +64,7 @@ ErrorCode CommandContainer::initialize(Device *device, AllocationsList *reusable
     }
 
     constexpr size_t heapSize = 65536u;
-    heapHelper = std::unique_ptr<HeapHelper>(new HeapHelper(device->getMemoryManager(), device->getDefaultEngine().commandStreamReceiver->getInternalAllocationStorage(), device->getNumGenericSubDevices() > 1u));
+    heapHelper = std::unique_ptr<HeapHelper>(new HeapHelper(device->getMemoryManager(), device->getDefaultEngine().commandStreamReceiver->getInternalAllocationStorage(), reusableAllocationList, device->getNumGenericSubDevices() > 1u));
 
     for (uint32_t i = 0; i < IndirectHeap::Type::NUM_TYPES; i++) {
         if (NEO::ApiSpecificConfig::getBindlessConfiguration() && i != IndirectHeap::INDIRECT_OBJECT) {
@@ -77,7 +77,7 @@ ErrorCode CommandContainer::initialize(Device *device, AllocationsList *reusable
         if (!allocationIndirectHeaps[i]) {
             return ErrorCode::OUT_OF_DEVICE_MEMORY;
         }
-        residencyContainer.push_back(allocationIndirectHeaps[i]);
+        addToResidencyContainer(allocationIndirectHeaps[i]);
 
         bool requireInternalHeap = (IndirectHeap::INDIRECT_OBJECT == i);
         indirectHeaps[i] = std::make_unique<IndirectHeap>(allocationIndirectHeaps[i], requireInternalHeap);
@@ -101,18 +101,36 @@ void CommandContainer::addToResidencyContainer(GraphicsAllocation *alloc) {
         return;
     }
 
-    this->residencyContainer.push_back(alloc);
+    if (this->residencySet.insert(alloc).second) {
+        this->residencyContainer.push_back(alloc);
+    }
+}
+
+void CommandContainer::removeFromResidencyContainer(GraphicsAllocation *alloc) {
+    this->residencySet.erase(alloc);
+    this->residencyContainer.erase(std::remove(this->residencyContainer.begin(), this->residencyContainer.end(), alloc), this->residencyContainer.end());
+}
+
+void CommandContainer::clearResidencyContainer() {
+    this->residencySet.clear();
+    this->residencyContainer.clear();
 }
 
 void CommandContainer::removeDuplicatesFromResidencyContainer() {
-    std::sort(this->residencyContainer.begin(), this->residencyContainer.end());
-    this->residencyContainer.erase(std::unique(this->residencyContainer.begin(), this->residencyContainer.end()), this->residencyContainer.end());
+    // Only allocations pushed directly to the container can be duplicated
+    if (this->residencyContainer.size() == this->residencySet.size()) {
+        return;
+    }
+    this->residencySet.clear();
+    this->residencyContainer.erase(std::remove_if(this->residencyContainer.begin(), this->residencyContainer.end(),
+                                                  [this](GraphicsAllocation *alloc) { return !this->residencySet.insert(alloc).second; }),
+                                   this->residencyContainer.end());
 }
 
 void CommandContainer::reset() {
     setDirtyStateForAllHeaps(true);
     slmSize = std::numeric_limits<uint32_t>::max();
-    getResidencyContainer().clear();
+    clearResidencyContainer();
     getDeallocationContainer().clear();
     sshAllocations.clear();
 
@@ -160,7 +178,7 @@ void *CommandContainer::getHeapSpaceAllowGrow(HeapType heapType,
         indirectHeap->replaceBuffer(newAlloc->getUnderlyingBuffer(),
                                     newAlloc->getUnderlyingBufferSize());
         auto newBase = indirectHeap->getHeapGpuBase();
-        getResidencyContainer().push_back(newAlloc);
+        addToResidencyContainer(newAlloc);
         getDeallocationContainer().push_back(oldAlloc);
         setIndirectHeapAllocation(heapType, newAlloc);
         if (oldBase != newBase) {
@@ -191,7 +209,7 @@ IndirectHeap *CommandContainer::getHeapWithRequiredSizeAndAlignment(HeapType hea
         indirectHeap->replaceBuffer(newAlloc->getUnderlyingBuffer(),
                                     newAlloc->getUnderlyingBufferSize());
         auto newBase = indirectHeap->getHeapGpuBase();
-        getResidencyContainer().push_back(newAlloc);
+        addToResidencyContainer(newAlloc);
         getDeallocationContainer().push_back(oldAlloc);
         setIndirectHeapAllocation(heapType, newAlloc);
         if (oldBase != newBase) {
@@ -213,7 +231,7 @@ IndirectHeap *CommandContainer::getHeapWithRequiredSizeAndAlignment(HeapType hea
 void CommandContainer::handleCmdBufferAllocations(size_t startIndex) {
     for (size_t i = startIndex; i < cmdBufferAllocations.size(); i++) {
         if (this->reusableAllocationList) {
-            this->device->getMemoryManager()->handleFenceCompletion(cmdBufferAllocations[i]);
+            // completion is checked when the allocation is taken from the list again
             reusableAllocationList->pushFrontOne(*cmdBufferAllocations[i]);
         } else {
             this->device->getMemoryManager()->freeGraphicsMemory(cmdBufferAllocations[i]);
@@ -226,7 +244,7 @@ GraphicsAllocation *CommandContainer::obtainNextCommandBufferAllocation() {
 
     GraphicsAllocation *cmdBufferAllocation = nullptr;
     if (this->reusableAllocationList) {
-        cmdBufferAllocation = this->reusableAllocationList->detachAllocation(alignedSize, nullptr, nullptr, GraphicsAllocation::AllocationType::COMMAND_BUFFER).release();
+        cmdBufferAllocation = this->reusableAllocationList->detachCompletedAllocation(alignedSize, alignedSize, *device->getMemoryManager(), GraphicsAllocation::AllocationType::COMMAND_BUFFER).release();
     }
     if (!cmdBufferAllocation) {
         AllocationProperties properties{device->getRootDeviceIndex(),
@@ -267,7 +285,7 @@ void CommandContainer::prepareBindfulSsh() {
                                                                                                  alignedSize,
                                                                                                  device->getRootDeviceIndex());
             UNRECOVERABLE_IF(!allocationIndirectHeaps[IndirectHeap::SURFACE_STATE]);
-            residencyContainer.push_back(allocationIndirectHeaps[IndirectHeap::SURFACE_STATE]);
+            addToResidencyContainer(allocationIndirectHeaps[IndirectHeap::SURFACE_STATE]);
 
             indirectHeaps[IndirectHeap::SURFACE_STATE] = std::make_unique<IndirectHeap>(allocationIndirectHeaps[IndirectHeap::SURFACE_STATE], false);
             indirectHeaps[IndirectHeap::SURFACE_STATE]->getSpace(reservedSshSize);
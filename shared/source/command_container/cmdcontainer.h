@@ -14,6 +14,7 @@
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <unordered_set>
 #include <vector>
 
 namespace NEO {
@@ -60,6 +61,8 @@ class CommandContainer : public NonCopyableOrMovableClass {
     std::vector<GraphicsAllocation *> &getDeallocationContainer() { return deallocationContainer; }
 
     void addToResidencyContainer(GraphicsAllocation *alloc);
+    void removeFromResidencyContainer(GraphicsAllocation *alloc);
+    void clearResidencyContainer();
     void removeDuplicatesFromResidencyContainer();
 
     LinearStream *getCommandStream() { return commandStream.get(); }
@@ -132,6 +135,9 @@ class CommandContainer : public NonCopyableOrMovableClass {
     std::unique_ptr<LinearStream> commandStream;
     std::unique_ptr<IndirectHeap> indirectHeaps[HeapType::NUM_TYPES];
     ResidencyContainer residencyContainer;
+    // Allocations added through addToResidencyContainer, keeps the container free of duplicates on insert.
+    // Removals have to go through removeFromResidencyContainer/clearResidencyContainer to keep it in sync.
+    std::unordered_set<GraphicsAllocation *> residencySet;
     std::vector<GraphicsAllocation *> deallocationContainer;
 
     bool isFlushTaskUsedForImmediate = false;
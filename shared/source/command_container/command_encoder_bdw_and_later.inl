@@ -163,8 +163,11 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
     }
 
     auto slmSizeNew = dispatchInterface->getSlmTotalSize();
+    // L3 config depends only on whether SLM is used, SLM size itself is programmed in IDD
+    bool l3ConfigChanged = container.slmSize == std::numeric_limits<uint32_t>::max() ||
+                           (container.slmSize != 0u) != (slmSizeNew != 0u);
     bool dirtyHeaps = container.isAnyHeapDirty();
-    bool flush = container.slmSize != slmSizeNew || dirtyHeaps || requiresUncachedMocs;
+    bool flush = l3ConfigChanged || dirtyHeaps || requiresUncachedMocs;
 
     if (flush) {
         PipeControlArgs args;
@@ -184,15 +187,15 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
             requiresUncachedMocs = false;
         }
 
-        if (container.slmSize != slmSizeNew) {
+        if (l3ConfigChanged) {
             EncodeL3State<Family>::encode(container, slmSizeNew != 0u);
-            container.slmSize = slmSizeNew;
 
             if (container.nextIddInBlock != container.getNumIddPerBlock()) {
                 EncodeMediaInterfaceDescriptorLoad<Family>::encode(container);
             }
         }
     }
+    container.slmSize = slmSizeNew;
 
     uint32_t numIDD = 0u;
     void *ptr = getInterfaceDescriptor(container, numIDD);
@@ -218,7 +221,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
     cmd.setPredicateEnable(isPredicate);
 
     if (ApiSpecificConfig::getBindlessConfiguration()) {
-        container.getResidencyContainer().push_back(device->getBindlessHeapsHelper()->getHeap(NEO::BindlessHeapsHelper::BindlesHeapType::GLOBAL_DSH)->getGraphicsAllocation());
+        container.addToResidencyContainer(device->getBindlessHeapsHelper()->getHeap(NEO::BindlessHeapsHelper::BindlesHeapType::GLOBAL_DSH)->getGraphicsAllocation());
     }
 
     EncodeDispatchKernel<Family>::adjustInterfaceDescriptorData(idd, hwInfo);
@@ -138,7 +138,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
             dispatchInterface->getDynamicStateHeapData(),
             device->getBindlessHeapsHelper(), hwInfo);
         if (ApiSpecificConfig::getBindlessConfiguration()) {
-            container.getResidencyContainer().push_back(device->getBindlessHeapsHelper()->getHeap(NEO::BindlessHeapsHelper::BindlesHeapType::GLOBAL_DSH)->getGraphicsAllocation());
+            container.addToResidencyContainer(device->getBindlessHeapsHelper()->getHeap(NEO::BindlessHeapsHelper::BindlesHeapType::GLOBAL_DSH)->getGraphicsAllocation());
         }
     }
 
@@ -7,12 +7,16 @@
 
 #include "shared/source/command_stream/aub_command_stream_receiver.h"
 
+#include "shared/source/aub_mem_dump/aub_compressed_file_writer.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/options.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/os_agnostic_memory_manager.h"
 #include "shared/source/os_interface/os_inc_base.h"
 #include "shared/source/os_interface/sys_calls_common.h"
@@ -89,21 +93,39 @@ static auto sizeMemoryWriteHeader = sizeof(CmdServicesMemTraceMemoryWrite) - siz
 
 extern const size_t g_dwordCountMax;
 
+AubFileStream::~AubFileStream() = default;
+
 void AubFileStream::open(const char *filePath) {
     fileHandle.open(filePath, std::ofstream::binary);
     fileName.assign(filePath);
+
+    pageHashes.clear();
+    skipUnchangedPages = NEO::DebugManager.flags.AubDumpSkipUnchangedPages.get();
+    if (NEO::DebugManager.flags.AubDumpCompression.get() && fileHandle.is_open()) {
+        compressedWriter = std::make_unique<AubCompressedFileWriter>(fileHandle, AubCompressedFileWriter::defaultBlockSize);
+    }
 }
 
 void AubFileStream::close() {
+    compressedWriter.reset();
+    pageHashes.clear();
     fileHandle.close();
     fileName.clear();
 }
 
 void AubFileStream::write(const char *data, size_t size) {
+    if (compressedWriter) {
+        compressedWriter->write(data, size);
+        return;
+    }
     fileHandle.write(data, size);
 }
 
 void AubFileStream::flush() {
+    if (compressedWriter) {
+        compressedWriter->flush();
+        return;
+    }
     fileHandle.flush();
 }
 
@@ -133,7 +155,59 @@ bool AubFileStream::init(uint32_t stepping, uint32_t device) {
 }
 
 void AubFileStream::writeMemory(uint64_t physAddress, const void *memory, size_t size, uint32_t addressSpace, uint32_t hint) {
-    writeMemoryWriteHeader(physAddress, size, addressSpace, hint);
+    constexpr auto pageSize = MemoryConstants::pageSize;
+    if (!skipUnchangedPages || (physAddress % pageSize) != 0 || (size % pageSize) != 0) {
+        invalidatePageHashes(physAddress, size, addressSpace);
+        writeMemoryBlock(physAddress, memory, size, addressSpace, hint);
+        return;
+    }
+
+    // write only runs of pages whose content differs from what was last written to them
+    size_t changedRunStart = 0u;
+    size_t changedRunSize = 0u;
+    for (size_t offset = 0u; offset < size; offset += pageSize) {
+        if (updatePageHash(physAddress + offset, ptrOffset(memory, offset), addressSpace)) {
+            if (changedRunSize == 0u) {
+                changedRunStart = offset;
+            }
+            changedRunSize += pageSize;
+            continue;
+        }
+        if (changedRunSize > 0u) {
+            writeMemoryBlock(physAddress + changedRunStart, ptrOffset(memory, changedRunStart), changedRunSize, addressSpace, hint);
+            changedRunSize = 0u;
+        }
+    }
+    if (changedRunSize > 0u) {
+        writeMemoryBlock(physAddress + changedRunStart, ptrOffset(memory, changedRunStart), changedRunSize, addressSpace, hint);
+    }
+}
+
+bool AubFileStream::updatePageHash(uint64_t physAddress, const void *memory, uint32_t addressSpace) {
+    auto hash = NEO::Hash::hash(reinterpret_cast<const char *>(memory), MemoryConstants::pageSize);
+    auto result = pageHashes.insert({physAddress | addressSpace, hash});
+    if (result.second) {
+        return true;
+    }
+    if (result.first->second == hash) {
+        return false;
+    }
+    result.first->second = hash;
+    return true;
+}
+
+void AubFileStream::invalidatePageHashes(uint64_t physAddress, size_t size, uint32_t addressSpace) {
+    if (pageHashes.empty()) {
+        return;
+    }
+    auto page = alignDown(physAddress, MemoryConstants::pageSize);
+    for (; page < physAddress + size; page += MemoryConstants::pageSize) {
+        pageHashes.erase(page | addressSpace);
+    }
+}
+
+void AubFileStream::writeMemoryBlock(uint64_t physAddress, const void *memory, size_t size, uint32_t addressSpace, uint32_t hint) {
+    writeMemoryWriteHeaderImpl(physAddress, size, addressSpace, hint);
 
     // Copy the contents from source to destination.
     write(reinterpret_cast<const char *>(memory), size);
@@ -147,6 +221,12 @@ void AubFileStream::writeMemory(uint64_t physAddress, const void *memory, size_t
 }
 
 void AubFileStream::writeMemoryWriteHeader(uint64_t physAddress, size_t size, uint32_t addressSpace, uint32_t hint) {
+    // data following the header is written directly by the caller, so its pages are no longer known
+    invalidatePageHashes(physAddress, size, addressSpace);
+    writeMemoryWriteHeaderImpl(physAddress, size, addressSpace, hint);
+}
+
+void AubFileStream::writeMemoryWriteHeaderImpl(uint64_t physAddress, size_t size, uint32_t addressSpace, uint32_t hint) {
     CmdServicesMemTraceMemoryWrite header = {};
     auto alignedBlockSize = (size + sizeof(uint32_t) - 1) & ~(sizeof(uint32_t) - 1);
     auto dwordCount = (sizeMemoryWriteHeader + alignedBlockSize) / sizeof(uint32_t);
@@ -113,6 +113,7 @@ class AUBCommandStreamReceiverHw : public CommandStreamReceiverSimulatedHw<GfxFa
 
   protected:
     constexpr static uint32_t getMaskAndValueForPollForCompletion();
+    void invalidatePageHashes(GraphicsAllocation &gfxAllocation);
 
     bool dumpAubNonWritable = false;
     bool isEngineInitialized = false;
@@ -16,6 +16,9 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/gmm_helper/gmm.h"
+#include "shared/source/gmm_helper/gmm_helper.h"
+#include "shared/source/gmm_helper/resource_info.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/constants.h"
@@ -683,6 +686,28 @@ bool AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
     return true;
 }
 
+template <typename GfxFamily>
+void AUBCommandStreamReceiverHw<GfxFamily>::invalidatePageHashes(GraphicsAllocation &gfxAllocation) {
+    if (aubManager || !getAubStream()->isSkippingUnchangedPages()) {
+        return;
+    }
+    auto gpuAddress = GmmHelper::decanonize(gfxAllocation.getGpuAddress());
+    auto size = gfxAllocation.getUnderlyingBufferSize();
+    if (gfxAllocation.isCompressionEnabled()) {
+        size = gfxAllocation.getDefaultGmm()->gmmResourceInfo->getSizeAllocation();
+    }
+    if (size == 0) {
+        return;
+    }
+
+    auto streamLocked = getAubStream()->lockStream();
+    PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        getAubStream()->invalidatePageHashes(physAddress, size, AubHelper::getMemTrace(entryBits));
+    };
+
+    ppgtt->pageWalk(static_cast<uintptr_t>(gpuAddress), size, 0, PageTableEntry::nonValidBits, walker, MemoryBanks::BankNotSpecified);
+}
+
 template <typename GfxFamily>
 bool AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(AllocationView &allocationView) {
     GraphicsAllocation gfxAllocation(this->rootDeviceIndex, GraphicsAllocation::AllocationType::UNKNOWN, reinterpret_cast<void *>(allocationView.first), allocationView.first, 0llu, allocationView.second, MemoryPool::MemoryNull, 0u);
@@ -754,6 +779,10 @@ void AUBCommandStreamReceiverHw<GfxFamily>::processResidency(const ResidencyCont
             DEBUG_BREAK_IF(!((gfxAllocation->getUnderlyingBufferSize() == 0) ||
                              !this->isAubWritable(*gfxAllocation)));
         }
+        if (!AubHelper::isGpuReadOnlyAllocationType(gfxAllocation->getAllocationType())) {
+            // GPU may modify the allocation in this submission, its next upload cannot be compared with the last one
+            invalidatePageHashes(*gfxAllocation);
+        }
         gfxAllocation->updateResidencyTaskCount(this->taskCount + 1, this->osContext->getContextId());
     }
 
@@ -47,6 +47,9 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
 
     latestSentStatelessMocsConfig = CacheSettings::unknownMocs;
     submissionAggregator.reset(new SubmissionAggregator());
+    submissionAggregator->setFlushThresholds(static_cast<uint32_t>(std::max(DebugManager.flags.BatchedDispatchMaxCommandBuffers.get(), 0)),
+                                             static_cast<size_t>(std::max(DebugManager.flags.BatchedDispatchMaxBytes.get(), 0) * MemoryConstants::kiloByte),
+                                             std::chrono::microseconds(std::max(DebugManager.flags.BatchedDispatchMaxDelayUs.get(), 0)));
     if (DebugManager.flags.CsrDispatchMode.get()) {
         this->dispatchMode = (DispatchMode)DebugManager.flags.CsrDispatchMode.get();
     }
@@ -165,8 +168,16 @@ void CommandStreamReceiver::waitForTaskCountAndCleanAllocationList(uint32_t requ
 
 void CommandStreamReceiver::waitForTaskCountAndCleanTemporaryAllocationList(uint32_t requiredTaskCount) {
     waitForTaskCountAndCleanAllocationList(requiredTaskCount, TEMPORARY_ALLOCATION);
+    releaseIdleScratchSpace();
 };
 
+void CommandStreamReceiver::releaseIdleScratchSpace() {
+    if (scratchSpaceController) {
+        auto lock = obtainUniqueOwnership();
+        scratchSpaceController->releaseIdleSharedScratchSpace();
+    }
+}
+
 void CommandStreamReceiver::ensureCommandBufferAllocation(LinearStream &commandStream, size_t minimumRequiredSize, size_t additionalAllocationSize) {
     if (commandStream.getAvailableSpace() >= minimumRequiredSize) {
         return;
@@ -382,6 +393,18 @@ void CommandStreamReceiver::initProgrammingFlags() {
     lastSentUseGlobalAtomics = false;
 }
 
+void CommandStreamReceiver::flushBatchedSubmissionsIfThresholdReached() {
+    if (this->dispatchMode != DispatchMode::BatchedDispatch) {
+        return;
+    }
+    // don't contend with submitting thread, flushTask checks the thresholds on its own
+    std::unique_lock<MutexType> lock(ownershipMutex, std::try_to_lock);
+    if (!lock.owns_lock() || !this->submissionAggregator->isFlushThresholdReached(std::chrono::steady_clock::now())) {
+        return;
+    }
+    this->flushBatchedSubmissions();
+}
+
 void CommandStreamReceiver::programForAubSubCapture(bool wasActiveInPreviousEnqueue, bool isActive) {
     if (!wasActiveInPreviousEnqueue && isActive) {
         // force CSR reprogramming upon subcapture activation
@@ -35,6 +35,7 @@
 #include "shared/source/os_interface/hw_info_config.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/utilities/tag_allocator.h"
+#include "shared/source/utilities/trace_recorder.h"
 
 #include "command_stream_receiver_hw_ext.inl"
 
@@ -162,6 +163,8 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     typedef typename GfxFamily::PIPE_CONTROL PIPE_CONTROL;
     typedef typename GfxFamily::STATE_BASE_ADDRESS STATE_BASE_ADDRESS;
 
+    TraceScope traceScope("submission", "flushTask");
+
     DEBUG_BREAK_IF(&commandStreamTask == &commandStream);
     DEBUG_BREAK_IF(!(dispatchFlags.preemptionMode == PreemptionMode::Disabled ? device.getPreemptionMode() == PreemptionMode::Disabled : true));
     DEBUG_BREAK_IF(taskLevel >= CompletionStamp::notReady);
@@ -625,6 +628,10 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     }
     implicitFlush |= checkImplicitFlushForGpuIdle();
 
+    if (this->dispatchMode == DispatchMode::BatchedDispatch && !implicitFlush) {
+        implicitFlush = this->submissionAggregator->isFlushThresholdReached(std::chrono::steady_clock::now());
+    }
+
     if (this->dispatchMode == DispatchMode::BatchedDispatch && implicitFlush) {
         this->flushBatchedSubmissions();
     }
@@ -852,6 +859,8 @@ inline size_t CommandStreamReceiverHw<GfxFamily>::getCmdSizeForPipelineSelect()
 
 template <typename GfxFamily>
 inline void CommandStreamReceiverHw<GfxFamily>::waitForTaskCountWithKmdNotifyFallback(uint32_t taskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep, bool forcePowerSavingMode) {
+    TraceScope traceScope("wait", "waitForTaskCount");
+
     int64_t waitTimeout = 0;
     bool enableTimeout = false;
 
@@ -930,8 +939,13 @@ inline void CommandStreamReceiverHw<GfxFamily>::programVFEState(LinearStream &cs
                                    (dispatchFlags.additionalKernelExecInfo != AdditionalKernelExecInfo::NotSet);
         streamProperties.frontEndState.setProperties(lastKernelExecutionType == KernelExecutionType::Concurrent,
                                                      disableOverdispatch, osContext->isEngineInstanced(), hwInfo);
+        auto perThreadScratchSize = requiredScratchSize;
+        if (scratchSpaceController->usesSharedScratchSpace() && scratchSpaceController->getScratchSpaceAllocation()) {
+            // shared surface is split into thread slots of the same size by every receiver using it
+            perThreadScratchSize = scratchSpaceController->getPerThreadScratchSpaceSize();
+        }
         PreambleHelper<GfxFamily>::programVfeState(
-            pVfeState, hwInfo, requiredScratchSize, getScratchPatchAddress(),
+            pVfeState, hwInfo, perThreadScratchSize, getScratchPatchAddress(),
             maxFrontEndThreads, streamProperties);
         auto commandOffset = PreambleHelper<GfxFamily>::getScratchSpaceAddressOffsetForVfeState(&csr, pVfeState);
 
@@ -7,6 +7,7 @@
 
 #include "shared/source/command_stream/scratch_space_controller.h"
 
+#include "shared/source/command_stream/scratch_space_manager.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/hw_helper.h"
@@ -20,9 +21,21 @@ ScratchSpaceController::ScratchSpaceController(uint32_t rootDeviceIndex, Executi
     auto hwInfo = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo();
     auto &hwHelper = HwHelper::get(hwInfo->platform.eRenderCoreFamily);
     computeUnitsUsedForScratch = hwHelper.getComputeUnitsUsedForScratch(hwInfo);
+    if (ScratchSpaceManager::isEnabled()) {
+        scratchSpaceManager = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getScratchSpaceManager();
+    }
 }
 
 ScratchSpaceController::~ScratchSpaceController() {
+    if (scratchSpaceManager) {
+        if (scratchAllocation) {
+            scratchSpaceManager->releaseAllocation(scratchAllocation);
+        }
+        if (privateScratchAllocation) {
+            scratchSpaceManager->releaseAllocation(privateScratchAllocation);
+        }
+        return;
+    }
     if (scratchAllocation) {
         getMemoryManager()->freeGraphicsMemory(scratchAllocation);
     }
@@ -35,4 +48,47 @@ MemoryManager *ScratchSpaceController::getMemoryManager() const {
     UNRECOVERABLE_IF(executionEnvironment.memoryManager.get() == nullptr);
     return executionEnvironment.memoryManager.get();
 }
+
+GraphicsAllocation *ScratchSpaceController::allocateScratchSurface(const AllocationProperties &properties, size_t &allocationSize) {
+    if (scratchSpaceManager) {
+        return scratchSpaceManager->obtainAllocation(properties, allocationSize);
+    }
+    allocationSize = properties.size;
+    return getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+}
+
+void ScratchSpaceController::releaseScratchSurface(GraphicsAllocation *allocation, uint32_t currentTaskCount, uint32_t contextId) {
+    allocation->updateTaskCount(currentTaskCount, contextId);
+    if (scratchSpaceManager) {
+        scratchSpaceManager->releaseAllocation(allocation);
+        return;
+    }
+    csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation), TEMPORARY_ALLOCATION);
+}
+
+void ScratchSpaceController::updateSharedScratchSpaceUseTime() {
+    if (scratchSpaceManager) {
+        sharedScratchSpaceUseTime = scratchSpaceManager->getCurrentTime();
+    }
+}
+
+void ScratchSpaceController::releaseIdleSharedScratchSpace() {
+    if (scratchSpaceManager == nullptr || (scratchAllocation == nullptr && privateScratchAllocation == nullptr)) {
+        return;
+    }
+    if (!scratchSpaceManager->isIdleTrimTimeElapsed(sharedScratchSpaceUseTime)) {
+        return;
+    }
+    // task counts of the surfaces were updated by residency, the manager frees them only after GPU completes
+    if (scratchAllocation) {
+        scratchSpaceManager->releaseAllocation(scratchAllocation);
+        scratchAllocation = nullptr;
+        scratchSizeBytes = 0u;
+    }
+    if (privateScratchAllocation) {
+        scratchSpaceManager->releaseAllocation(privateScratchAllocation);
+        privateScratchAllocation = nullptr;
+        privateScratchSizeBytes = 0u;
+    }
+}
 } // namespace NEO
@@ -9,6 +9,7 @@
 #include "shared/source/helpers/bindless_heaps_helper.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 
@@ -21,6 +22,8 @@ class MemoryManager;
 struct HardwareInfo;
 class OsContext;
 class CommandStreamReceiver;
+class ScratchSpaceManager;
+struct AllocationProperties;
 
 namespace ScratchSpaceConstants {
 constexpr size_t scratchSpaceOffsetFor64Bit = 4096u;
@@ -57,6 +60,13 @@ class ScratchSpaceController {
         return static_cast<uint32_t>(privateScratchSizeBytes / computeUnitsUsedForScratch);
     }
 
+    bool usesSharedScratchSpace() const {
+        return scratchSpaceManager != nullptr;
+    }
+    // Drops references to shared scratch surfaces not used for the idle trim time, so the scratch space manager can free them.
+    // A later submission requiring scratch obtains a surface again and reprograms the state pointing to it.
+    void releaseIdleSharedScratchSpace();
+
     virtual void reserveHeap(IndirectHeap::Type heapType, IndirectHeap *&indirectHeap) = 0;
     virtual void programHeaps(HeapContainer &heapContainer,
                               uint32_t scratchSlot,
@@ -77,12 +87,17 @@ class ScratchSpaceController {
 
   protected:
     MemoryManager *getMemoryManager() const;
+    GraphicsAllocation *allocateScratchSurface(const AllocationProperties &properties, size_t &allocationSize);
+    void releaseScratchSurface(GraphicsAllocation *allocation, uint32_t currentTaskCount, uint32_t contextId);
+    void updateSharedScratchSpaceUseTime();
 
     const uint32_t rootDeviceIndex;
     ExecutionEnvironment &executionEnvironment;
     GraphicsAllocation *scratchAllocation = nullptr;
     GraphicsAllocation *privateScratchAllocation = nullptr;
     InternalAllocationStorage &csrAllocationStorage;
+    ScratchSpaceManager *scratchSpaceManager = nullptr;
+    std::chrono::steady_clock::time_point sharedScratchSpaceUseTime{};
     size_t scratchSizeBytes = 0;
     size_t privateScratchSizeBytes = 0;
     bool force32BitAllocation = false;
@@ -157,34 +157,33 @@ void ScratchSpaceControllerXeHPAndLater::prepareScratchAllocation(uint32_t requi
                                                                   bool &stateBaseAddressDirty,
                                                                   bool &scratchSurfaceDirty,
                                                                   bool &vfeStateDirty) {
+    updateSharedScratchSpaceUseTime();
     uint32_t requiredPerThreadScratchSizeAlignedUp = alignUp(requiredPerThreadScratchSize, 64);
     size_t requiredScratchSizeInBytes = requiredPerThreadScratchSizeAlignedUp * computeUnitsUsedForScratch;
     scratchSurfaceDirty = false;
     auto multiTileCapable = osContext.getNumSupportedDevices() > 1;
     if (scratchSizeBytes < requiredScratchSizeInBytes) {
         if (scratchAllocation) {
-            scratchAllocation->updateTaskCount(currentTaskCount, osContext.getContextId());
-            csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(scratchAllocation), TEMPORARY_ALLOCATION);
+            releaseScratchSurface(scratchAllocation, currentTaskCount, osContext.getContextId());
         }
         scratchSurfaceDirty = true;
         scratchSizeBytes = requiredScratchSizeInBytes;
-        perThreadScratchSize = requiredPerThreadScratchSizeAlignedUp;
         AllocationProperties properties{this->rootDeviceIndex, true, scratchSizeBytes, GraphicsAllocation::AllocationType::SCRATCH_SURFACE, multiTileCapable, false, osContext.getDeviceBitfield()};
-        scratchAllocation = getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+        scratchAllocation = allocateScratchSurface(properties, scratchSizeBytes);
+        perThreadScratchSize = static_cast<uint32_t>(scratchSizeBytes / computeUnitsUsedForScratch);
     }
     if (privateScratchSpaceSupported) {
         uint32_t requiredPerThreadPrivateScratchSizeAlignedUp = alignUp(requiredPerThreadPrivateScratchSize, 64);
         size_t requiredPrivateScratchSizeInBytes = requiredPerThreadPrivateScratchSizeAlignedUp * computeUnitsUsedForScratch;
         if (privateScratchSizeBytes < requiredPrivateScratchSizeInBytes) {
             if (privateScratchAllocation) {
-                privateScratchAllocation->updateTaskCount(currentTaskCount, osContext.getContextId());
-                csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(privateScratchAllocation), TEMPORARY_ALLOCATION);
+                releaseScratchSurface(privateScratchAllocation, currentTaskCount, osContext.getContextId());
             }
             privateScratchSizeBytes = requiredPrivateScratchSizeInBytes;
-            perThreadPrivateScratchSize = requiredPerThreadPrivateScratchSizeAlignedUp;
             scratchSurfaceDirty = true;
             AllocationProperties properties{this->rootDeviceIndex, true, privateScratchSizeBytes, GraphicsAllocation::AllocationType::PRIVATE_SURFACE, multiTileCapable, false, osContext.getDeviceBitfield()};
-            privateScratchAllocation = getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+            privateScratchAllocation = allocateScratchSurface(properties, privateScratchSizeBytes);
+            perThreadPrivateScratchSize = static_cast<uint32_t>(privateScratchSizeBytes / computeUnitsUsedForScratch);
         }
     }
 }
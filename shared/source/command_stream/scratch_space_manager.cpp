@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/scratch_space_manager.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/execution_environment/execution_environment.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+
+#include <algorithm>
+
+namespace NEO {
+ScratchSpaceManager::ScratchSpaceManager(ExecutionEnvironment &executionEnvironment) : executionEnvironment(executionEnvironment) {
+    if (DebugManager.flags.SharedScratchSpaceIdleTrimTime.get() != -1) {
+        idleTrimTime = std::chrono::milliseconds(DebugManager.flags.SharedScratchSpaceIdleTrimTime.get());
+    }
+}
+
+ScratchSpaceManager::~ScratchSpaceManager() {
+    for (auto &entry : entries) {
+        executionEnvironment.memoryManager->freeGraphicsMemory(entry.allocation);
+    }
+}
+
+bool ScratchSpaceManager::isEnabled() {
+    return DebugManager.flags.EnableSharedScratchSpace.get();
+}
+
+GraphicsAllocation *ScratchSpaceManager::obtainAllocation(const AllocationProperties &properties, size_t &allocationSize) {
+    std::lock_guard<std::mutex> lock(mtx);
+    trimLocked(getCurrentTime());
+
+    size_t newSize = properties.size;
+    for (auto &entry : entries) {
+        if (entry.retired ||
+            entry.allocation->getAllocationType() != properties.allocationType ||
+            entry.allocation->getRootDeviceIndex() != properties.rootDeviceIndex ||
+            entry.subDevicesBitfield != properties.subDevicesBitfield ||
+            entry.multiOsContextCapable != !!properties.flags.multiOsContextCapable) {
+            continue;
+        }
+        if (entry.size >= properties.size) {
+            entry.references++;
+            allocationSize = entry.size;
+            return entry.allocation;
+        }
+        // receivers still holding the smaller surface keep using it, new requests get the grown one
+        entry.retired = true;
+        newSize = std::max(newSize, 2 * entry.size);
+    }
+
+    auto newProperties = properties;
+    newProperties.size = newSize;
+    auto allocation = executionEnvironment.memoryManager->allocateGraphicsMemoryWithProperties(newProperties);
+    if (allocation == nullptr) {
+        return nullptr;
+    }
+
+    Entry entry;
+    entry.allocation = allocation;
+    entry.size = newSize;
+    entry.subDevicesBitfield = properties.subDevicesBitfield;
+    entry.multiOsContextCapable = !!properties.flags.multiOsContextCapable;
+    entry.references = 1u;
+    entries.push_back(entry);
+
+    allocationSize = newSize;
+    return allocation;
+}
+
+void ScratchSpaceManager::releaseAllocation(GraphicsAllocation *allocation) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto now = getCurrentTime();
+    for (auto &entry : entries) {
+        if (entry.allocation == allocation) {
+            DEBUG_BREAK_IF(entry.references == 0u);
+            entry.references--;
+            entry.releaseTime = now;
+            break;
+        }
+    }
+    trimLocked(now);
+}
+
+void ScratchSpaceManager::trim() {
+    std::lock_guard<std::mutex> lock(mtx);
+    trimLocked(getCurrentTime());
+}
+
+bool ScratchSpaceManager::isIdleTrimTimeElapsed(std::chrono::steady_clock::time_point lastUseTime) const {
+    return getCurrentTime() - lastUseTime >= idleTrimTime;
+}
+
+size_t ScratchSpaceManager::getAllocationsCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return entries.size();
+}
+
+void ScratchSpaceManager::trimLocked(std::chrono::steady_clock::time_point now) {
+    auto memoryManager = executionEnvironment.memoryManager.get();
+    auto it = entries.begin();
+    while (it != entries.end()) {
+        bool canBeFreed = it->references == 0u &&
+                          (it->retired || now - it->releaseTime >= idleTrimTime) &&
+                          !memoryManager->allocInUse(*it->allocation);
+        if (canBeFreed) {
+            memoryManager->freeGraphicsMemory(it->allocation);
+            it = entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+std::chrono::steady_clock::time_point ScratchSpaceManager::getCurrentTime() const {
+    return std::chrono::steady_clock::now();
+}
+} // namespace NEO
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/memory_manager/allocation_properties.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class ExecutionEnvironment;
+class GraphicsAllocation;
+
+// Root device wide owner of scratch and private surfaces shared by command stream receivers.
+// Receivers with the same device bitfield get the most recent surface as long as it is large enough,
+// a larger request replaces it with a surface at least twice its size.
+// Surfaces no longer held by any receiver are freed once completed on GPU and idle for the trim time.
+// Receivers drop their references at synchronization points after not using scratch for the trim time.
+// All receivers holding a surface program the per thread size derived from the surface size, never their own
+// requirement, so receivers running concurrently on different engines do not overlap thread slots.
+class ScratchSpaceManager : NonCopyableOrMovableClass {
+  public:
+    ScratchSpaceManager(ExecutionEnvironment &executionEnvironment);
+    MOCKABLE_VIRTUAL ~ScratchSpaceManager();
+
+    static bool isEnabled();
+
+    GraphicsAllocation *obtainAllocation(const AllocationProperties &properties, size_t &allocationSize);
+    void releaseAllocation(GraphicsAllocation *allocation);
+    void trim();
+    bool isIdleTrimTimeElapsed(std::chrono::steady_clock::time_point lastUseTime) const;
+    MOCKABLE_VIRTUAL std::chrono::steady_clock::time_point getCurrentTime() const;
+
+    size_t getAllocationsCount();
+
+  protected:
+    struct Entry {
+        GraphicsAllocation *allocation = nullptr;
+        size_t size = 0u;
+        DeviceBitfield subDevicesBitfield{};
+        bool multiOsContextCapable = false;
+        bool retired = false;
+        uint32_t references = 0u;
+        std::chrono::steady_clock::time_point releaseTime{};
+    };
+
+    void trimLocked(std::chrono::steady_clock::time_point now);
+
+    ExecutionEnvironment &executionEnvironment;
+    std::vector<Entry> entries;
+    std::chrono::milliseconds idleTrimTime{1000};
+    std::mutex mtx;
+};
+} // namespace NEO
@@ -11,9 +11,38 @@
 #include "shared/source/memory_manager/graphics_allocation.h"
 
 void NEO::SubmissionAggregator::recordCommandBuffer(CommandBuffer *commandBuffer) {
+    if (this->cmdBuffers.peekIsEmpty()) {
+        this->recordedCommandBuffersCount = 0u;
+        this->recordedBytes = 0u;
+        this->firstRecordTime = std::chrono::steady_clock::now();
+    }
+    this->recordedCommandBuffersCount++;
+    this->recordedBytes += commandBuffer->batchBuffer.usedSize - commandBuffer->batchBuffer.startOffset;
     this->cmdBuffers.pushTailOne(*commandBuffer);
 }
 
+void NEO::SubmissionAggregator::setFlushThresholds(uint32_t maxCommandBuffers, size_t maxBytes, std::chrono::microseconds maxDelay) {
+    this->maxCommandBuffers = maxCommandBuffers;
+    this->maxBytes = maxBytes;
+    this->maxDelay = maxDelay;
+}
+
+bool NEO::SubmissionAggregator::isFlushThresholdReached(std::chrono::steady_clock::time_point now) {
+    if (this->cmdBuffers.peekIsEmpty()) {
+        return false;
+    }
+    if (this->maxCommandBuffers != 0u && this->recordedCommandBuffersCount >= this->maxCommandBuffers) {
+        return true;
+    }
+    if (this->maxBytes != 0u && this->recordedBytes >= this->maxBytes) {
+        return true;
+    }
+    if (this->maxDelay.count() != 0 && now - this->firstRecordTime >= this->maxDelay) {
+        return true;
+    }
+    return false;
+}
+
 void NEO::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resourcePackage, size_t &totalUsedSize, size_t totalMemoryBudget, uint32_t osContextId) {
     auto primaryCommandBuffer = this->cmdBuffers.peekHead();
     auto currentInspection = this->inspectionId;
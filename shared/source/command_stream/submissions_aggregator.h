@@ -12,6 +12,7 @@
 #include "shared/source/utilities/idlist.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <chrono>
 #include <vector>
 namespace NEO {
 class Device;
@@ -73,8 +74,23 @@ class SubmissionAggregator {
     void aggregateCommandBuffers(ResourcePackage &resourcePackage, size_t &totalUsedSize, size_t totalMemoryBudget, uint32_t osContextId);
     CommandBufferList &peekCmdBufferList() { return cmdBuffers; }
 
+    void setFlushThresholds(uint32_t maxCommandBuffers, size_t maxBytes, std::chrono::microseconds maxDelay);
+    bool isFlushThresholdReached(std::chrono::steady_clock::time_point now);
+    uint32_t peekRecordedCommandBuffersCount() const { return recordedCommandBuffersCount; }
+    size_t peekRecordedBytes() const { return recordedBytes; }
+
   protected:
     CommandBufferList cmdBuffers;
     uint32_t inspectionId = 1;
+
+    // statistics of command buffers recorded since the list was last empty
+    uint32_t recordedCommandBuffersCount = 0u;
+    size_t recordedBytes = 0u;
+    std::chrono::steady_clock::time_point firstRecordTime;
+
+    // 0 means threshold is disabled
+    uint32_t maxCommandBuffers = 0u;
+    size_t maxBytes = 0u;
+    std::chrono::microseconds maxDelay{0};
 };
 } // namespace NEO
@@ -8,10 +8,10 @@
 #pragma once
 #include "shared/source/aub_mem_dump/aub_mem_dump.h"
 #include "shared/source/helpers/common_types.h"
+#include "shared/source/tbx/tbx_sockets.h"
 
 namespace NEO {
 class CommandStreamReceiver;
-class TbxSockets;
 class ExecutionEnvironment;
 
 class TbxStream : public AubMemDump::AubStream {
@@ -35,6 +35,7 @@ class TbxStream : public AubMemDump::AubStream {
     void writeMMIOImpl(uint32_t offset, uint32_t value) override;
     void registerPoll(uint32_t registerOffset, uint32_t mask, uint32_t value, bool pollNotEqual, uint32_t timeoutAction) override;
     void readMemory(uint64_t physAddress, void *memory, size_t size);
+    void readMemory(const std::vector<TbxSockets::MemoryRead> &reads);
 };
 
 struct TbxCommandStreamReceiver {
@@ -538,11 +538,13 @@ void TbxCommandStreamReceiverHw<GfxFamily>::downloadAllocation(GraphicsAllocatio
     auto length = gfxAllocation.getUnderlyingBufferSize();
 
     if (length) {
+        std::vector<TbxSockets::MemoryRead> reads;
         PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
             DEBUG_BREAK_IF(offset > length);
-            tbxStream.readMemory(physAddress, ptrOffset(cpuAddress, offset), size);
+            reads.push_back({physAddress, ptrOffset(cpuAddress, offset), size});
         };
         ppgtt->pageWalk(static_cast<uintptr_t>(gpuAddress), length, 0, 0, walker, this->getMemoryBank(&gfxAllocation));
+        tbxStream.readMemory(reads);
     }
 }
 
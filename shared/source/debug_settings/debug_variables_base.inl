@@ -30,6 +30,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, SetCommandStreamReceiver, -1, "Set command strea
 DECLARE_DEBUG_VARIABLE(int32_t, TbxPort, 4321, "TCP-IP port of TBX server")
 DECLARE_DEBUG_VARIABLE(int32_t, HBMSizePerTileInGigabytes, 0, "Size of HBM memory in GigaBytes per tile.")
 DECLARE_DEBUG_VARIABLE(bool, TbxFrontdoorMode, false, "Set TBX frontdoor mode for read and write memory accesses (the default mode is via backdoor)")
+DECLARE_DEBUG_VARIABLE(bool, TbxBatchedSockets, false, "Coalesce TBX requests without a response into batches sent with a single call and pipeline memory reads of downloaded allocations")
 DECLARE_DEBUG_VARIABLE(bool, FlattenBatchBufferForAUBDump, false, "Dump multi-level batch buffers to AUB as single, flat batch buffer")
 DECLARE_DEBUG_VARIABLE(bool, AddPatchInfoCommentsForAUBDump, false, "Dump comments containing allocations and patching information")
 DECLARE_DEBUG_VARIABLE(bool, UseAubStream, true, "Use aub_stream for aub dumping")
@@ -37,6 +38,8 @@ DECLARE_DEBUG_VARIABLE(bool, AUBDumpAllocsOnEnqueueReadOnly, false, "Force dumpi
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpAllocsOnEnqueueSVMMemcpyOnly, false, "Force dumping allocations on clEnqueueSVMMemcpy only (blocking calls)")
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpForceAllToLocalMemory, false, "Force placing every allocation in local memory address space")
 DECLARE_DEBUG_VARIABLE(bool, GenerateAubFilePerProcessId, false, "Generate aub file with process id")
+DECLARE_DEBUG_VARIABLE(bool, AubDumpSkipUnchangedPages, false, "Skip writing full pages whose content did not change since they were last written to the AUB file. Pages of allocations writable by GPU are rewritten after every submission they were resident in")
+DECLARE_DEBUG_VARIABLE(bool, AubDumpCompression, false, "Write AUB file as compressed blocks on a background thread, expand with scripts/expand_aub.py")
 
 /*DEBUG FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableSWTags, false, "Enable software tagging in batch buffer")
@@ -73,9 +76,12 @@ DECLARE_DEBUG_VARIABLE(bool, EnableFlushTaskSubmission, false, "true: driver use
 DECLARE_DEBUG_VARIABLE(bool, DoNotFreeResources, false, "true: driver stops freeing resources")
 DECLARE_DEBUG_VARIABLE(bool, AllowMixingRegularAndCooperativeKernels, false, "true: driver allows mixing regular and cooperative kernels in a single command list and in a single execute")
 DECLARE_DEBUG_VARIABLE(bool, AllowPatchingVfeStateInCommandLists, false, "true: MEDIA_VFE_STATE may be programmed in a command list")
+DECLARE_DEBUG_VARIABLE(bool, FreezeCommandListsOnClose, false, "true: residency and migration data of a command list are collected once on close and reused by every execution until reset")
+DECLARE_DEBUG_VARIABLE(bool, EnableSharedScratchSpace, false, "true: command stream receivers of a root device share scratch and private surfaces, which grow geometrically and are trimmed when idle")
 DECLARE_DEBUG_VARIABLE(bool, PrintMemoryRegionSizes, false, "print memory bank type, instance and it's size")
 DECLARE_DEBUG_VARIABLE(bool, UpdateCrossThreadDataSize, false, "Turn on cross thread data size calculation for PATCH TOKEN binary")
 DECLARE_DEBUG_VARIABLE(std::string, ForceDeviceId, std::string("unk"), "DeviceId selected for testing")
+DECLARE_DEBUG_VARIABLE(std::string, ChromeTraceFile, std::string("unk"), "When set, API calls, submissions, waits and profiled GPU commands are traced in Chrome trace event format to this file")
 DECLARE_DEBUG_VARIABLE(std::string, LoadBinarySipFromFile, std::string("unk"), "Select binary file to load SIP kernel raw binary. When file named *_header.* exists, it is used as header")
 DECLARE_DEBUG_VARIABLE(std::string, InjectInternalBuildOptions, std::string("unk"), "Appends internal build options string to user modules")
 DECLARE_DEBUG_VARIABLE(int64_t, OverrideMultiStoragePlacement, -1, "-1: disable, 0+: tile mask, each bit corresponds to tile")
@@ -178,12 +184,16 @@ DECLARE_DEBUG_VARIABLE(int32_t, ForceTile0PlacementForTile1ResourcesWaActive, -1
 DECLARE_DEBUG_VARIABLE(int32_t, ClosEnabled, -1, "-1: default, 0: disabled, 1: enabled. Enable CLOS based cache reservation")
 DECLARE_DEBUG_VARIABLE(int32_t, EngineUsageHint, -1, "-1: default, >=0: engine usage value to use when creating command queue on user selected engine")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceBcsEngineIndex, -1, "-1: default, >=0 Copy Engine index")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsCopy, -1, "Split read/write buffer transfers across multiple copy engines. -1: default, 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMask, 0, "0: default (all available copy engines), >0: bitmask of copy engine indices used for split transfers")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsSize, -1, "-1: default (16MB), >0: minimal size in KB of a single chunk of split transfer")
 DECLARE_DEBUG_VARIABLE(int32_t, Force2dImageAsArray, -1, "-1: default, 0: WA Disabled, 1: Forces surface state of 2dImage to array")
 
 /*LOGGING FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, PrintDriverDiagnostics, -1, "prints driver diagnostics messages to standard output, value corresponds to hint level")
 DECLARE_DEBUG_VARIABLE(bool, PrintOsContextInitializations, false, "print initialized OsContexts to standard output")
 DECLARE_DEBUG_VARIABLE(bool, PrintDeviceAndEngineIdOnSubmission, false, "print submissions device and engine IDs to standard output")
+DECLARE_DEBUG_VARIABLE(bool, PrintSkippedStateCommandsSize, false, "print size of state commands not programmed on command queue submission, because state did not change")
 DECLARE_DEBUG_VARIABLE(bool, PrintExecutionBuffer, false, "print execution buffer information to standard output")
 DECLARE_DEBUG_VARIABLE(bool, PrintBOsForSubmit, false, "print all BOs passed to submission")
 DECLARE_DEBUG_VARIABLE(bool, PrintDebugSettings, false, "Dump all debug variables settings to text file. Print to stdout if value is different than default.")
@@ -191,6 +201,7 @@ DECLARE_DEBUG_VARIABLE(bool, PrintDebugMessages, false, "when enabled, some debu
 DECLARE_DEBUG_VARIABLE(bool, DumpKernels, false, "Enables dumping kernels' program source code to text files and program from binary to bin file")
 DECLARE_DEBUG_VARIABLE(bool, DumpKernelArgs, false, "Enables dumping kernels args to binary files")
 DECLARE_DEBUG_VARIABLE(bool, LogApiCalls, false, "Enables logging api function calls, inputs and outputs to file")
+DECLARE_DEBUG_VARIABLE(bool, LogApiCallsBinary, false, "With LogApiCalls, records are buffered per thread and written in binary format by a background thread, decode with scripts/decode_binary_log.py")
 DECLARE_DEBUG_VARIABLE(bool, LogPatchTokens, false, "Enables logging patch tokens, inputs and outputs to file")
 DECLARE_DEBUG_VARIABLE(bool, LogTaskCounts, false, "Enables logging taskCounts and taskLevels to file")
 DECLARE_DEBUG_VARIABLE(bool, LogAlignedAllocations, false, "Logs alignedMalloc and alignedFree allocations")
@@ -236,12 +247,18 @@ DECLARE_DEBUG_VARIABLE(int32_t, EnableHostPtrTracking, -1, "Enable host ptr trac
 DECLARE_DEBUG_VARIABLE(int32_t, MaxHwThreadsPercent, 0, "If not zero then maximum number of used HW threads is capped to max * MaxHwThreadsPercent / 100")
 DECLARE_DEBUG_VARIABLE(int32_t, MinHwThreadsUnoccupied, 0, "If not zero then maximum number of used HW threads is reduced by MinHwThreadsUnoccupied")
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushEveryEnqueueCount, -1, "If greater than 0, driver performs implicit flush every N submissions.")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedDispatchMaxCommandBuffers, -1, "If greater than 0, in batched dispatch mode driver performs implicit flush once N command buffers are pending.")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedDispatchMaxBytes, -1, "If greater than 0, in batched dispatch mode driver performs implicit flush once pending command buffers exceed N KB.")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedDispatchMaxDelayUs, -1, "If greater than 0, in batched dispatch mode driver performs implicit flush when the oldest pending command buffer waits longer than N microseconds. Checked only in flushTask and when polling event status, not on a timer")
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushForNewResource, -1, "-1: platform specific, 0: force disable, 1: force enable")
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushForIdleGpu, -1, "-1: platform specific, 0: force disable, 1: force enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCacheFlushAfterWalkerForAllQueues, -1, "Enable cache flush after walker even if queue doesn't require it")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideKernelSizeLimitForSmallDispatch, -1, "-1: default, >=0: on XEHP+ changes the threshold for treating kernel as small during NULL LWS selection")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideUseKmdWaitFunction, -1, "-1: default (L0: disabled), 0: disabled, 1: enabled. It uses only busy loop to wait or busy loop with KMD wait function, when KMD fallback is enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, ResolveDependenciesViaPipeControls, -1, "-1: default , 0: disabled, 1: enabled. If enabled, instead of programming semaphores, dependencies are resolved using task levels")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanTelemetrySamplingInterval, -1, "-1: default (disabled), >0: sample sysman power, temperature, frequency and engine telemetry on a background thread every N ms and serve queries from the latest sample")
+DECLARE_DEBUG_VARIABLE(int32_t, SharedScratchSpaceIdleTrimTime, -1, "-1: default (1000 ms), >=0: shared scratch surfaces not held by any command stream receiver and completed on GPU for N ms are freed")
+DECLARE_DEBUG_VARIABLE(int32_t, ChromeTraceBufferedEvents, -1, "-1: default (16384), >0: number of trace events buffered before they are written to ChromeTraceFile")
 
 /*DIRECT SUBMISSION FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionPrintBuffers, false, "Print address of submitted command buffers")
@@ -374,6 +391,9 @@ DECLARE_DEBUG_VARIABLE(int32_t, UpdateTaskCountFromWait, -1, " Do not update tas
 DECLARE_DEBUG_VARIABLE(int32_t, EnableTimestampWait, -1, "Wait using timestamps, -1: default(disabled), 0: disabled, 1: enabled where UpdateTaskCountFromWait enabled, 2: enabled on gpgpue engine with direct submission, 3: enabled on any direct submission, 4: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, DeferOsContextInitialization, -1, "-1: default, 0: create all contexts immediately, 1: defer, if possible")
 DECLARE_DEBUG_VARIABLE(int32_t, UsmInitialPlacement, -1, "-1: default, 0: optimize for first CPU access, 1: optimize for first GPU access")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelScopedUsmMigration, -1, "-1: default, 0: migrate all resident shared allocations on submission, 1: migrate only shared allocations referenced by submitted work, all of them only for kernels with indirect shared access")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableUsmPrefetchMigration, -1, "-1: default, 0: memory prefetch of shared allocations is a hint only, 1: memory prefetch migrates shared allocations to the requested domain ahead of use")
+DECLARE_DEBUG_VARIABLE(int32_t, UsmPageFaultMigrationGranularity, -1, "-1: default - shared allocations migrate as a whole, >0: size in KB of independently migrated chunks with per chunk dirty tracking")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceHostPointerImport, -1, "-1: default, 0: disable, 1: enable, Forces the driver to import every host pointer coming into driver, WARNING this is not spec complaint.")
 DECLARE_DEBUG_VARIABLE(bool, UseMaxSimdSizeToDeduceMaxWorkgroupSize, false, "With this flag on, max workgroup size is deduced using SIMD32 instead of SIMD8, this causes the max wkg size to be 4 times bigger")
 DECLARE_DEBUG_VARIABLE(bool, ReturnRawGpuTimestamps, false, "Driver returns raw GPU tiemstamps instead of calculated ones.")
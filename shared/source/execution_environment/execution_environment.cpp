@@ -9,6 +9,7 @@
 
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/built_ins/sip.h"
+#include "shared/source/command_stream/scratch_space_manager.h"
 #include "shared/source/direct_submission/direct_submission_controller.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/affinity_mask.h"
@@ -33,6 +34,7 @@ void ExecutionEnvironment::releaseRootDeviceEnvironmentResources(RootDeviceEnvir
     if (rootDeviceEnvironment->builtins.get()) {
         rootDeviceEnvironment->builtins.get()->freeSipKernels(memoryManager.get());
     }
+    rootDeviceEnvironment->scratchSpaceManager.reset();
 }
 
 ExecutionEnvironment::~ExecutionEnvironment() {
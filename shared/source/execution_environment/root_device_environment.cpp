@@ -10,6 +10,7 @@
 #include "shared/source/ail/ail_configuration.h"
 #include "shared/source/aub/aub_center.h"
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/command_stream/scratch_space_manager.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/default_cache_config.h"
 #include "shared/source/debugger/debugger.h"
@@ -126,4 +127,14 @@ BuiltIns *RootDeviceEnvironment::getBuiltIns() {
     }
     return this->builtins.get();
 }
+
+ScratchSpaceManager *RootDeviceEnvironment::getScratchSpaceManager() {
+    if (this->scratchSpaceManager.get() == nullptr) {
+        std::lock_guard<std::mutex> autolock(this->mtx);
+        if (this->scratchSpaceManager.get() == nullptr) {
+            this->scratchSpaceManager = std::make_unique<ScratchSpaceManager>(executionEnvironment);
+        }
+    }
+    return this->scratchSpaceManager.get();
+}
 } // namespace NEO
@@ -31,6 +31,7 @@ class MemoryManager;
 class MemoryOperationsHandler;
 class OSInterface;
 class OSTime;
+class ScratchSpaceManager;
 class SipKernel;
 class SWTagsManager;
 struct HardwareInfo;
@@ -59,6 +60,7 @@ struct RootDeviceEnvironment {
     GmmClientContext *getGmmClientContext() const;
     MOCKABLE_VIRTUAL CompilerInterface *getCompilerInterface();
     BuiltIns *getBuiltIns();
+    ScratchSpaceManager *getScratchSpaceManager();
     BindlessHeapsHelper *getBindlessHeapsHelper() const;
     void createBindlessHeapsHelper(MemoryManager *memoryManager, bool availableDevices, uint32_t rootDeviceIndex, DeviceBitfield deviceBitfield);
 
@@ -74,6 +76,7 @@ struct RootDeviceEnvironment {
     std::unique_ptr<BuiltIns> builtins;
     std::unique_ptr<Debugger> debugger;
     std::unique_ptr<SWTagsManager> tagsManager;
+    std::unique_ptr<ScratchSpaceManager> scratchSpaceManager;
     ExecutionEnvironment &executionEnvironment;
 
     AffinityMaskHelper deviceAffinityMask{true};
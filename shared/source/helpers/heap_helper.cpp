@@ -7,7 +7,9 @@
 
 #include "shared/source/helpers/heap_helper.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
+#include "shared/source/memory_manager/allocations_list.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
@@ -20,6 +22,14 @@ GraphicsAllocation *HeapHelper::getHeapAllocation(uint32_t heapType, size_t heap
         allocationType = GraphicsAllocation::AllocationType::INTERNAL_HEAP;
     }
 
+    if (this->reusableAllocationList) {
+        // heaps grow by doubling, don't hand out allocations from a bigger size class
+        auto allocation = this->reusableAllocationList->detachCompletedAllocation(heapSize, 2 * heapSize - 1, *this->memManager, allocationType);
+        if (allocation) {
+            return allocation.release();
+        }
+    }
+
     auto allocation = this->storageForReuse->obtainReusableAllocation(heapSize, allocationType);
     if (allocation) {
         return allocation.release();
@@ -31,6 +41,10 @@ GraphicsAllocation *HeapHelper::getHeapAllocation(uint32_t heapType, size_t heap
 }
 void HeapHelper::storeHeapAllocation(GraphicsAllocation *heapAllocation) {
     if (heapAllocation) {
+        if (this->reusableAllocationList && !DebugManager.flags.DisableResourceRecycling.get()) {
+            this->reusableAllocationList->pushFrontOne(*heapAllocation);
+            return;
+        }
         this->storageForReuse->storeAllocation(std::unique_ptr<NEO::GraphicsAllocation>(heapAllocation), NEO::AllocationUsage::REUSABLE_ALLOCATION);
     }
 }
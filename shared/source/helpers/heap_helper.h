@@ -11,21 +11,24 @@
 
 namespace NEO {
 
+class AllocationsList;
 class MemoryManager;
 class GraphicsAllocation;
 class InternalAllocationStorage;
 
 class HeapHelper {
   public:
-    HeapHelper(MemoryManager *memManager, InternalAllocationStorage *storageForReuse, bool isMultiOsContextCapable) : isMultiOsContextCapable(isMultiOsContextCapable),
-                                                                                                                      storageForReuse(storageForReuse),
-                                                                                                                      memManager(memManager) {}
+    HeapHelper(MemoryManager *memManager, InternalAllocationStorage *storageForReuse, AllocationsList *reusableAllocationList, bool isMultiOsContextCapable) : isMultiOsContextCapable(isMultiOsContextCapable),
+                                                                                                                                                              storageForReuse(storageForReuse),
+                                                                                                                                                              reusableAllocationList(reusableAllocationList),
+                                                                                                                                                              memManager(memManager) {}
     GraphicsAllocation *getHeapAllocation(uint32_t heapType, size_t heapSize, size_t alignment, uint32_t rootDeviceIndex);
     void storeHeapAllocation(GraphicsAllocation *heapAllocation);
     bool isMultiOsContextCapable = false;
 
   protected:
     InternalAllocationStorage *storageForReuse = nullptr;
+    AllocationsList *reusableAllocationList = nullptr;
     MemoryManager *memManager = nullptr;
 };
 } // namespace NEO
@@ -9,16 +9,20 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 
+#include <limits>
+
 namespace NEO {
 
 struct ReusableAllocationRequirements {
     const void *requiredPtr;
     size_t requiredMinimalSize;
+    size_t requiredMaximalSize;
     volatile uint32_t *csrTagAddress;
     GraphicsAllocation::AllocationType allocationType;
     uint32_t contextId;
     uint32_t activeTileCount;
     uint32_t tagOffset;
+    MemoryManager *memoryManager;
 };
 
 AllocationsList::AllocationsList(AllocationUsage allocationUsage)
@@ -30,12 +34,30 @@ AllocationsList::AllocationsList()
 std::unique_ptr<GraphicsAllocation> AllocationsList::detachAllocation(size_t requiredMinimalSize, const void *requiredPtr, CommandStreamReceiver *commandStreamReceiver, GraphicsAllocation::AllocationType allocationType) {
     ReusableAllocationRequirements req;
     req.requiredMinimalSize = requiredMinimalSize;
+    req.requiredMaximalSize = std::numeric_limits<size_t>::max();
     req.csrTagAddress = (commandStreamReceiver == nullptr) ? nullptr : commandStreamReceiver->getTagAddress();
     req.allocationType = allocationType;
     req.contextId = (commandStreamReceiver == nullptr) ? UINT32_MAX : commandStreamReceiver->getOsContext().getContextId();
     req.requiredPtr = requiredPtr;
     req.activeTileCount = (commandStreamReceiver == nullptr) ? 1u : commandStreamReceiver->getActivePartitions();
     req.tagOffset = (commandStreamReceiver == nullptr) ? 0u : commandStreamReceiver->getPostSyncWriteOffset();
+    req.memoryManager = nullptr;
+    GraphicsAllocation *a = nullptr;
+    GraphicsAllocation *retAlloc = processLocked<AllocationsList, &AllocationsList::detachAllocationImpl>(a, static_cast<void *>(&req));
+    return std::unique_ptr<GraphicsAllocation>(retAlloc);
+}
+
+std::unique_ptr<GraphicsAllocation> AllocationsList::detachCompletedAllocation(size_t requiredMinimalSize, size_t requiredMaximalSize, MemoryManager &memoryManager, GraphicsAllocation::AllocationType allocationType) {
+    ReusableAllocationRequirements req;
+    req.requiredMinimalSize = requiredMinimalSize;
+    req.requiredMaximalSize = requiredMaximalSize;
+    req.csrTagAddress = nullptr;
+    req.allocationType = allocationType;
+    req.contextId = UINT32_MAX;
+    req.requiredPtr = nullptr;
+    req.activeTileCount = 1u;
+    req.tagOffset = 0u;
+    req.memoryManager = &memoryManager;
     GraphicsAllocation *a = nullptr;
     GraphicsAllocation *retAlloc = processLocked<AllocationsList, &AllocationsList::detachAllocationImpl>(a, static_cast<void *>(&req));
     return std::unique_ptr<GraphicsAllocation>(retAlloc);
@@ -46,7 +68,16 @@ GraphicsAllocation *AllocationsList::detachAllocationImpl(GraphicsAllocation *,
     auto *curr = head;
     while (curr != nullptr) {
         if ((req->allocationType == curr->getAllocationType()) &&
-            (curr->getUnderlyingBufferSize() >= req->requiredMinimalSize)) {
+            (curr->getUnderlyingBufferSize() >= req->requiredMinimalSize) &&
+            (curr->getUnderlyingBufferSize() <= req->requiredMaximalSize)) {
+            if (req->memoryManager != nullptr) {
+                // allocations may be stored right after their last use, take only those completed on all engines
+                if (!req->memoryManager->allocInUse(*curr)) {
+                    return removeOneImpl(curr, nullptr);
+                }
+                curr = curr->next;
+                continue;
+            }
             if (req->csrTagAddress == nullptr) {
                 return removeOneImpl(curr, nullptr);
             }
@@ -68,7 +99,7 @@ void AllocationsList::freeAllGraphicsAllocations(Device *neoDevice) {
     auto *curr = head;
     while (curr != nullptr) {
         auto currNext = curr->next;
-        neoDevice->getMemoryManager()->freeGraphicsMemory(curr);
+        neoDevice->getMemoryManager()->checkGpuUsageAndDestroyGraphicsAllocations(curr);
         curr = currNext;
     }
     head = nullptr;
@@ -20,6 +20,7 @@ class AllocationsList : public IDList<GraphicsAllocation, true, true> {
     AllocationsList(AllocationUsage allocationUsage);
     AllocationsList();
     std::unique_ptr<GraphicsAllocation> detachAllocation(size_t requiredMinimalSize, const void *requiredPtr, CommandStreamReceiver *commandStreamReceiver, GraphicsAllocation::AllocationType allocationType);
+    std::unique_ptr<GraphicsAllocation> detachCompletedAllocation(size_t requiredMinimalSize, size_t requiredMaximalSize, MemoryManager &memoryManager, GraphicsAllocation::AllocationType allocationType);
     void freeAllGraphicsAllocations(Device *neoDevice);
 
   private:
@@ -8,11 +8,14 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/options.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
+#include <algorithm>
 #include <mutex>
 
 namespace NEO {
@@ -29,8 +32,18 @@ void PageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager
     }
     const auto domain = initialPlacementCpu ? AllocationDomain::Cpu : AllocationDomain::None;
 
+    PageFaultData pageFaultData{size, unifiedMemoryManager, cmdQ, domain};
+    const int32_t granularity = DebugManager.flags.UsmPageFaultMigrationGranularity.get();
+    if (granularity > 0 && this->gpuDomainHandler == &PageFaultManager::handleGpuDomainTransferForHw) {
+        const auto chunkSize = alignUp(static_cast<size_t>(granularity * MemoryConstants::kiloByte), MemoryConstants::pageSize);
+        if (size > chunkSize) {
+            pageFaultData.chunkSize = chunkSize;
+            pageFaultData.chunks.assign((size + chunkSize - 1) / chunkSize, ChunkData{domain, initialPlacementCpu});
+        }
+    }
+
     std::unique_lock<SpinLock> lock{mtx};
-    this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, domain}));
+    this->memoryData.insert(std::make_pair(ptr, std::move(pageFaultData)));
     if (!initialPlacementCpu) {
         this->protectCPUMemoryAccess(ptr, size);
     }
@@ -41,7 +54,7 @@ void PageFaultManager::removeAllocation(void *ptr) {
     auto alloc = memoryData.find(ptr);
     if (alloc != memoryData.end()) {
         auto &pageFaultData = alloc->second;
-        if (pageFaultData.domain == AllocationDomain::Gpu) {
+        if (pageFaultData.domain == AllocationDomain::Gpu || pageFaultData.chunkSize != 0u) {
             allowCPUMemoryAccess(ptr, pageFaultData.size);
         }
         this->memoryData.erase(ptr);
@@ -53,7 +66,9 @@ void PageFaultManager::moveAllocationToGpuDomain(void *ptr) {
     auto alloc = memoryData.find(ptr);
     if (alloc != memoryData.end()) {
         auto &pageFaultData = alloc->second;
-        if (pageFaultData.domain != AllocationDomain::Gpu) {
+        if (pageFaultData.chunkSize != 0u && pageFaultData.domain != AllocationDomain::Gpu) {
+            this->moveChunksToGpuDomain(ptr, pageFaultData);
+        } else if (pageFaultData.domain != AllocationDomain::Gpu) {
             if (pageFaultData.domain == AllocationDomain::Cpu) {
                 if (DebugManager.flags.PrintUmdSharedMigration.get()) {
                     printf("UMD transferring shared allocation %llx from CPU to GPU\n", reinterpret_cast<unsigned long long int>(ptr));
@@ -66,12 +81,38 @@ void PageFaultManager::moveAllocationToGpuDomain(void *ptr) {
     }
 }
 
+void PageFaultManager::moveAllocationToCpuDomain(void *ptr) {
+    std::unique_lock<SpinLock> lock{mtx};
+    auto alloc = memoryData.find(ptr);
+    if (alloc != memoryData.end()) {
+        auto &pageFaultData = alloc->second;
+        if (pageFaultData.domain == AllocationDomain::Cpu && pageFaultData.chunkSize == 0u) {
+            return;
+        }
+        this->setAubWritable(true, ptr, pageFaultData.unifiedMemoryManager);
+        if (pageFaultData.chunkSize != 0u) {
+            for (size_t chunkIndex = 0u; chunkIndex < pageFaultData.chunks.size(); chunkIndex++) {
+                if (pageFaultData.chunks[chunkIndex].domain != AllocationDomain::Cpu) {
+                    this->handleChunkPageFault(ptr, pageFaultData, ptrOffset(ptr, chunkIndex * pageFaultData.chunkSize));
+                }
+            }
+        } else {
+            gpuDomainHandler(this, ptr, pageFaultData);
+        }
+    }
+}
+
 void PageFaultManager::moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocsManager *unifiedMemoryManager) {
     std::unique_lock<SpinLock> lock{mtx};
     for (auto &alloc : this->memoryData) {
         auto allocPtr = alloc.first;
         auto &pageFaultData = alloc.second;
-        if (pageFaultData.unifiedMemoryManager == unifiedMemoryManager && pageFaultData.domain != AllocationDomain::Gpu) {
+        if (pageFaultData.unifiedMemoryManager != unifiedMemoryManager) {
+            continue;
+        }
+        if (pageFaultData.chunkSize != 0u && pageFaultData.domain != AllocationDomain::Gpu) {
+            this->moveChunksToGpuDomain(allocPtr, pageFaultData);
+        } else if (pageFaultData.domain != AllocationDomain::Gpu) {
             if (pageFaultData.domain == AllocationDomain::Cpu) {
                 if (DebugManager.flags.PrintUmdSharedMigration.get()) {
                     printf("UMD transferring shared allocation %llx from CPU to GPU\n", reinterpret_cast<unsigned long long int>(allocPtr));
@@ -86,16 +127,23 @@ void PageFaultManager::moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocs
 
 bool PageFaultManager::verifyPageFault(void *ptr) {
     std::unique_lock<SpinLock> lock{mtx};
-    for (auto &alloc : this->memoryData) {
-        auto allocPtr = alloc.first;
-        auto &pageFaultData = alloc.second;
-        if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
-            this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
-            gpuDomainHandler(this, allocPtr, pageFaultData);
-            return true;
-        }
+    auto alloc = this->memoryData.upper_bound(ptr);
+    if (alloc == this->memoryData.begin()) {
+        return false;
+    }
+    --alloc;
+    auto allocPtr = alloc->first;
+    auto &pageFaultData = alloc->second;
+    if (ptr >= ptrOffset(allocPtr, pageFaultData.size)) {
+        return false;
+    }
+    this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
+    if (pageFaultData.chunkSize != 0u) {
+        this->handleChunkPageFault(allocPtr, pageFaultData, ptr);
+    } else {
+        gpuDomainHandler(this, allocPtr, pageFaultData);
     }
-    return false;
+    return true;
 }
 
 void PageFaultManager::setGpuDomainHandler(gpuDomainHandlerFunc gpuHandlerFuncPtr) {
@@ -125,6 +173,71 @@ void PageFaultManager::handleGpuDomainTransferForAubAndTbx(PageFaultManager *pag
     pageFaultData.domain = AllocationDomain::Cpu;
 }
 
+void PageFaultManager::handleChunkPageFault(void *allocPtr, PageFaultData &pageFaultData, void *faultPtr) {
+    const auto chunkIndex = ptrDiff(faultPtr, allocPtr) / pageFaultData.chunkSize;
+    const auto chunkOffset = chunkIndex * pageFaultData.chunkSize;
+    const auto chunkSize = std::min(pageFaultData.chunkSize, pageFaultData.size - chunkOffset);
+    auto chunkPtr = ptrOffset(allocPtr, chunkOffset);
+    auto &chunk = pageFaultData.chunks[chunkIndex];
+
+    if (chunk.domain == AllocationDomain::Cpu) {
+        // chunk was migrated read-only, this is the first CPU write to it
+        chunk.dirty = true;
+        this->allowCPUMemoryAccess(chunkPtr, chunkSize);
+        return;
+    }
+
+    if (chunk.domain == AllocationDomain::Gpu) {
+        if (DebugManager.flags.PrintUmdSharedMigration.get()) {
+            printf("UMD transferring shared allocation %llx chunk %llx from GPU to CPU\n", reinterpret_cast<unsigned long long int>(allocPtr), static_cast<unsigned long long int>(chunkOffset));
+        }
+        this->transferRangeToCpu(allocPtr, chunkOffset, chunkSize, pageFaultData.cmdQ);
+        chunk.dirty = false;
+        this->allowCPUMemoryReadAccess(chunkPtr, chunkSize);
+    } else {
+        chunk.dirty = true;
+        this->allowCPUMemoryAccess(chunkPtr, chunkSize);
+    }
+    chunk.domain = AllocationDomain::Cpu;
+    pageFaultData.domain = AllocationDomain::Cpu;
+}
+
+void PageFaultManager::moveChunksToGpuDomain(void *allocPtr, PageFaultData &pageFaultData) {
+    auto &chunks = pageFaultData.chunks;
+    const auto chunksCount = chunks.size();
+
+    size_t chunkIndex = 0u;
+    while (chunkIndex < chunksCount) {
+        if (chunks[chunkIndex].domain != AllocationDomain::Cpu) {
+            chunks[chunkIndex++].domain = AllocationDomain::Gpu;
+            continue;
+        }
+
+        // coalesce neighbouring CPU chunks with the same dirty state into one transfer
+        const bool dirty = chunks[chunkIndex].dirty;
+        auto rangeEnd = chunkIndex + 1;
+        while (rangeEnd < chunksCount && chunks[rangeEnd].domain == AllocationDomain::Cpu && chunks[rangeEnd].dirty == dirty) {
+            rangeEnd++;
+        }
+        const auto rangeOffset = chunkIndex * pageFaultData.chunkSize;
+        const auto rangeSize = std::min(rangeEnd * pageFaultData.chunkSize, pageFaultData.size) - rangeOffset;
+
+        if (dirty) {
+            if (DebugManager.flags.PrintUmdSharedMigration.get()) {
+                printf("UMD transferring shared allocation %llx range %llx-%llx from CPU to GPU\n", reinterpret_cast<unsigned long long int>(allocPtr),
+                       static_cast<unsigned long long int>(rangeOffset), static_cast<unsigned long long int>(rangeOffset + rangeSize));
+            }
+            this->transferRangeToGpu(allocPtr, rangeOffset, rangeSize, pageFaultData.cmdQ);
+        }
+        this->protectCPUMemoryAccess(ptrOffset(allocPtr, rangeOffset), rangeSize);
+
+        for (; chunkIndex < rangeEnd; chunkIndex++) {
+            chunks[chunkIndex] = {AllocationDomain::Gpu, false};
+        }
+    }
+    pageFaultData.domain = AllocationDomain::Gpu;
+}
+
 void PageFaultManager::selectGpuDomainHandler() {
     if (DebugManager.flags.SetCommandStreamReceiver.get() == CommandStreamReceiverType::CSR_AUB ||
         DebugManager.flags.SetCommandStreamReceiver.get() == CommandStreamReceiverType::CSR_TBX ||
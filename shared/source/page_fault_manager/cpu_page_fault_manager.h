@@ -12,8 +12,9 @@
 
 #include "memory_properties_flags.h"
 
+#include <map>
 #include <memory>
-#include <unordered_map>
+#include <vector>
 
 namespace NEO {
 class GraphicsAllocation;
@@ -27,6 +28,7 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     virtual ~PageFaultManager() = default;
 
     MOCKABLE_VIRTUAL void moveAllocationToGpuDomain(void *ptr);
+    MOCKABLE_VIRTUAL void moveAllocationToCpuDomain(void *ptr);
     void moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocsManager *unifiedMemoryManager);
     void insertAllocation(void *ptr, size_t size, SVMAllocsManager *unifiedMemoryManager, void *cmdQ, const MemoryProperties &memoryProperties);
     void removeAllocation(void *ptr);
@@ -37,11 +39,18 @@ class PageFaultManager : public NonCopyableOrMovableClass {
         Gpu,
     };
 
+    struct ChunkData {
+        AllocationDomain domain;
+        bool dirty;
+    };
+
     struct PageFaultData {
         size_t size;
         SVMAllocsManager *unifiedMemoryManager;
         void *cmdQ;
         AllocationDomain domain;
+        size_t chunkSize = 0u; // 0 - allocation is migrated as a whole
+        std::vector<ChunkData> chunks;
     };
 
     typedef void (*gpuDomainHandlerFunc)(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
@@ -50,6 +59,7 @@ class PageFaultManager : public NonCopyableOrMovableClass {
 
     virtual void allowCPUMemoryAccess(void *ptr, size_t size) = 0;
     virtual void protectCPUMemoryAccess(void *ptr, size_t size) = 0;
+    virtual void allowCPUMemoryReadAccess(void *ptr, size_t size) = 0;
     MOCKABLE_VIRTUAL void transferToCpu(void *ptr, size_t size, void *cmdQ);
 
   protected:
@@ -57,15 +67,21 @@ class PageFaultManager : public NonCopyableOrMovableClass {
 
     MOCKABLE_VIRTUAL bool verifyPageFault(void *ptr);
     MOCKABLE_VIRTUAL void transferToGpu(void *ptr, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferRangeToCpu(void *allocPtr, size_t offset, size_t size, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferRangeToGpu(void *allocPtr, size_t offset, size_t size, void *cmdQ);
     MOCKABLE_VIRTUAL void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
 
     static void handleGpuDomainTransferForHw(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
     static void handleGpuDomainTransferForAubAndTbx(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
     void selectGpuDomainHandler();
 
+    void handleChunkPageFault(void *allocPtr, PageFaultData &pageFaultData, void *faultPtr);
+    void moveChunksToGpuDomain(void *allocPtr, PageFaultData &pageFaultData);
+
     decltype(&handleGpuDomainTransferForHw) gpuDomainHandler = &handleGpuDomainTransferForHw;
 
-    std::unordered_map<void *, PageFaultData> memoryData;
+    // ordered by address, so faulting allocation is found with a single lookup
+    std::map<void *, PageFaultData> memoryData;
     SpinLock mtx;
 };
 } // namespace NEO
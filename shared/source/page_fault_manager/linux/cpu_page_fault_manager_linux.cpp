@@ -63,6 +63,11 @@ void PageFaultManagerLinux::protectCPUMemoryAccess(void *ptr, size_t size) {
     UNRECOVERABLE_IF(retVal != 0);
 }
 
+void PageFaultManagerLinux::allowCPUMemoryReadAccess(void *ptr, size_t size) {
+    auto retVal = mprotect(ptr, size, PROT_READ);
+    UNRECOVERABLE_IF(retVal != 0);
+}
+
 void PageFaultManagerLinux::callPreviousHandler(int signal, siginfo_t *info, void *context) {
     if (previousPageFaultHandler.sa_flags & SA_SIGINFO) {
         previousPageFaultHandler.sa_sigaction(signal, info, context);
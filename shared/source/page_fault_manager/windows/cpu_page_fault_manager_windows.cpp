@@ -54,6 +54,12 @@ void PageFaultManagerWindows::protectCPUMemoryAccess(void *ptr, size_t size) {
     UNRECOVERABLE_IF(!retVal);
 }
 
+void PageFaultManagerWindows::allowCPUMemoryReadAccess(void *ptr, size_t size) {
+    DWORD previousState;
+    auto retVal = VirtualProtect(ptr, size, PAGE_READONLY, &previousState);
+    UNRECOVERABLE_IF(!retVal);
+}
+
 void PageFaultManagerWindows::evictMemoryAfterImplCopy(GraphicsAllocation *allocation, Device *device) {}
 
 } // namespace NEO
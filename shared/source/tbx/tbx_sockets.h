@@ -7,6 +7,7 @@
 
 #pragma once
 #include <string>
+#include <vector>
 
 namespace NEO {
 
@@ -24,6 +25,19 @@ class TbxSockets {
     virtual bool readMemory(uint64_t addr, void *memory, size_t size) = 0;
     virtual bool writeMemory(uint64_t addr, const void *memory, size_t size, uint32_t type) = 0;
 
+    struct MemoryRead {
+        uint64_t address;
+        void *memory;
+        size_t size;
+    };
+    virtual bool readMemoryPipelined(const std::vector<MemoryRead> &reads) {
+        bool success = true;
+        for (auto &read : reads) {
+            success &= readMemory(read.address, read.memory, read.size);
+        }
+        return success;
+    }
+
     virtual bool readMMIO(uint32_t offset, uint32_t *value) = 0;
     virtual bool writeMMIO(uint32_t offset, uint32_t value) = 0;
 
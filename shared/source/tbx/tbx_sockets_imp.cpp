@@ -7,6 +7,7 @@
 
 #include "shared/source/tbx/tbx_sockets_imp.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/string.h"
 
@@ -18,8 +19,10 @@ typedef int socklen_t;
 #else
 #include <arpa/inet.h>
 #include <netdb.h>
+#include <netinet/tcp.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/uio.h>
 #include <unistd.h>
 typedef struct sockaddr SOCKADDR;
 #define SOCKET_ERROR -1
@@ -28,6 +31,7 @@ typedef struct sockaddr SOCKADDR;
 #endif
 #include "tbx_proto.h"
 
+#include <algorithm>
 #include <cstdint>
 
 namespace NEO {
@@ -36,8 +40,25 @@ TbxSocketsImp::TbxSocketsImp(std::ostream &err)
     : cerrStream(err) {
 }
 
+namespace {
+void setReadMemoryRequest(HAS_MSG &cmd, uint32_t transId, uint64_t addrOffset, size_t size) {
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.hdr.msg_type = HAS_READ_DATA_REQ_TYPE;
+    cmd.hdr.trans_id = transId;
+    cmd.hdr.size = sizeof(HAS_READ_DATA_REQ);
+    cmd.u.read_req.address = static_cast<uint32_t>(addrOffset);
+    cmd.u.read_req.address_h = static_cast<uint32_t>(addrOffset >> 32);
+    cmd.u.read_req.addr_type = 0;
+    cmd.u.read_req.size = static_cast<uint32_t>(size);
+    cmd.u.read_req.ownership_req = 0;
+    cmd.u.read_req.frontdoor = 0;
+    cmd.u.read_req.cacheline_disable = cmd.u.read_req.frontdoor;
+}
+} // namespace
+
 void TbxSocketsImp::close() {
     if (0 != m_socket) {
+        flushPendingData(nullptr, 0);
 #ifdef WIN32
         ::shutdown(m_socket, 0x02 /*SD_BOTH*/);
 
@@ -81,6 +102,14 @@ bool TbxSocketsImp::init(const std::string &hostNameOrIp, uint16_t port) {
             break;
         }
 
+        batchedMode = DebugManager.flags.TbxBatchedSockets.get();
+        if (batchedMode) {
+            // requests are coalesced here, so the kernel should not delay small segments
+            int noDelay = 1;
+            ::setsockopt(m_socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char *>(&noDelay), sizeof(noDelay));
+            pendingData.reserve(maxPendingDataSize + maxCopiedWriteSize + sizeof(HAS_MSG));
+        }
+
         HAS_MSG cmd;
         memset(&cmd, 0, sizeof(cmd));
         cmd.hdr.msg_type = HAS_CONTROL_REQ_TYPE;
@@ -96,7 +125,7 @@ bool TbxSocketsImp::init(const std::string &hostNameOrIp, uint16_t port) {
         cmd.u.control_req.has_mask = 1;
         cmd.u.control_req.has = 1;
 
-        sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+        sendRequest(&cmd, sizeof(HAS_HDR) + cmd.hdr.size, nullptr, 0);
     } while (false);
 
     return m_socket != INVALID_SOCKET;
@@ -146,7 +175,8 @@ bool TbxSocketsImp::readMMIO(uint32_t offset, uint32_t *data) {
         cmd.u.mmio_req.msg_type = MSG_TYPE_MMIO;
         cmd.u.mmio_req.size = sizeof(uint32_t);
 
-        success = sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+        success = sendRequest(&cmd, sizeof(HAS_HDR) + cmd.hdr.size, nullptr, 0) &&
+                  flushPendingData(nullptr, 0);
         if (!success) {
             break;
         }
@@ -183,49 +213,70 @@ bool TbxSocketsImp::writeMMIO(uint32_t offset, uint32_t value) {
     cmd.u.mmio_req.write = 1;
     cmd.u.mmio_req.size = sizeof(uint32_t);
 
-    return sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+    // MMIO writes submit work, so everything written before has to reach the simulator now
+    return sendRequest(&cmd, sizeof(HAS_HDR) + cmd.hdr.size, nullptr, 0) &&
+           flushPendingData(nullptr, 0);
 }
 
 bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
     HAS_MSG cmd;
-    memset(&cmd, 0, sizeof(cmd));
-    cmd.hdr.msg_type = HAS_READ_DATA_REQ_TYPE;
-    cmd.hdr.trans_id = transID++;
-    cmd.hdr.size = sizeof(HAS_READ_DATA_REQ);
-    cmd.u.read_req.address = static_cast<uint32_t>(addrOffset);
-    cmd.u.read_req.address_h = static_cast<uint32_t>(addrOffset >> 32);
-    cmd.u.read_req.addr_type = 0;
-    cmd.u.read_req.size = static_cast<uint32_t>(size);
-    cmd.u.read_req.ownership_req = 0;
-    cmd.u.read_req.frontdoor = 0;
-    cmd.u.read_req.cacheline_disable = cmd.u.read_req.frontdoor;
+    setReadMemoryRequest(cmd, getNextTransID(), addrOffset, size);
 
     bool success;
     do {
-        success = sendWriteData(&cmd, sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_REQ));
+        success = sendRequest(&cmd, sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_REQ), nullptr, 0) &&
+                  flushPendingData(nullptr, 0);
         if (!success) {
             break;
         }
 
-        HAS_MSG resp;
-        success = getResponseData(&resp, sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_RES));
-        if (!success) {
-            break;
-        }
+        success = getReadMemoryResponse(cmd.hdr.trans_id, data, size);
+    } while (false);
 
-        if (resp.hdr.msg_type != HAS_READ_DATA_RES_TYPE || resp.hdr.trans_id != cmd.hdr.trans_id) {
-            cerrStream << "Out of sequence read data packet?" << std::endl;
-            success = false;
-            break;
+    DEBUG_BREAK_IF(!success);
+    return success;
+}
+
+bool TbxSocketsImp::readMemoryPipelined(const std::vector<MemoryRead> &reads) {
+    if (!batchedMode) {
+        return TbxSockets::readMemoryPipelined(reads);
+    }
+
+    // the window bounds responses in flight, so the server never blocks on a full socket while requests are sent
+    bool success = true;
+    for (size_t first = 0; success && first < reads.size(); first += maxPipelinedReads) {
+        auto last = std::min(reads.size(), first + maxPipelinedReads);
+        auto firstTransId = transID;
+        for (auto i = first; i < last; i++) {
+            HAS_MSG cmd;
+            setReadMemoryRequest(cmd, getNextTransID(), reads[i].address, reads[i].size);
+            pendingData.insert(pendingData.end(), reinterpret_cast<const char *>(&cmd), reinterpret_cast<const char *>(&cmd) + sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_REQ));
         }
 
-        success = getResponseData(data, size);
-    } while (false);
+        success = flushPendingData(nullptr, 0);
+        for (auto i = first; success && i < last; i++) {
+            success = getReadMemoryResponse(firstTransId + static_cast<uint32_t>(i - first), reads[i].memory, reads[i].size);
+        }
+    }
 
     DEBUG_BREAK_IF(!success);
     return success;
 }
 
+bool TbxSocketsImp::getReadMemoryResponse(uint32_t transId, void *data, size_t size) {
+    HAS_MSG resp;
+    if (!getResponseData(&resp, sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_RES))) {
+        return false;
+    }
+
+    if (resp.hdr.msg_type != HAS_READ_DATA_RES_TYPE || resp.hdr.trans_id != transId) {
+        cerrStream << "Out of sequence read data packet?" << std::endl;
+        return false;
+    }
+
+    return getResponseData(data, size);
+}
+
 bool TbxSocketsImp::writeMemory(uint64_t physAddr, const void *data, size_t size, uint32_t type) {
     HAS_MSG cmd;
     memset(&cmd, 0, sizeof(cmd));
@@ -242,19 +293,7 @@ bool TbxSocketsImp::writeMemory(uint64_t physAddr, const void *data, size_t size
     cmd.u.write_req.cacheline_disable = cmd.u.write_req.frontdoor;
     cmd.u.write_req.memory_type = type;
 
-    bool success;
-    do {
-        success = sendWriteData(&cmd, sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ));
-        if (!success) {
-            break;
-        }
-
-        success = sendWriteData(data, size);
-        if (!success) {
-            cerrStream << "Problem sending write data?" << std::endl;
-            break;
-        }
-    } while (false);
+    bool success = sendRequest(&cmd, sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ), data, size);
 
     DEBUG_BREAK_IF(!success);
     return success;
@@ -271,7 +310,42 @@ bool TbxSocketsImp::writeGTT(uint32_t offset, uint64_t entry) {
     cmd.u.gtt64_req.data = static_cast<uint32_t>(entry & 0xffffffff);
     cmd.u.gtt64_req.data_h = static_cast<uint32_t>(entry >> 32);
 
-    return sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+    return sendRequest(&cmd, sizeof(HAS_HDR) + cmd.hdr.size, nullptr, 0);
+}
+
+bool TbxSocketsImp::sendRequest(const void *request, size_t requestSize, const void *data, size_t dataSize) {
+    if (!batchedMode) {
+        if (!sendWriteData(request, requestSize)) {
+            return false;
+        }
+        if (dataSize > 0 && !sendWriteData(data, dataSize)) {
+            cerrStream << "Problem sending write data?" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    auto requestBytes = reinterpret_cast<const char *>(request);
+    pendingData.insert(pendingData.end(), requestBytes, requestBytes + requestSize);
+    if (dataSize > maxCopiedWriteSize) {
+        // large payloads are sent from the caller's memory instead of being copied into the batch
+        return flushPendingData(data, dataSize);
+    }
+    auto dataBytes = reinterpret_cast<const char *>(data);
+    pendingData.insert(pendingData.end(), dataBytes, dataBytes + dataSize);
+    if (pendingData.size() >= maxPendingDataSize) {
+        return flushPendingData(nullptr, 0);
+    }
+    return true;
+}
+
+bool TbxSocketsImp::flushPendingData(const void *extraData, size_t extraDataSize) {
+    if (pendingData.empty() && extraDataSize == 0) {
+        return true;
+    }
+    auto success = sendWriteDataVector(pendingData.data(), pendingData.size(), extraData, extraDataSize);
+    pendingData.clear();
+    return success;
 }
 
 bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
@@ -295,6 +369,48 @@ bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
     return true;
 }
 
+bool TbxSocketsImp::sendWriteDataVector(const void *buffer, size_t sizeInBytes, const void *extraBuffer, size_t extraSizeInBytes) {
+#ifdef WIN32
+    return (sizeInBytes == 0 || sendWriteData(buffer, sizeInBytes)) &&
+           (extraSizeInBytes == 0 || sendWriteData(extraBuffer, extraSizeInBytes));
+#else
+    iovec buffers[2];
+    size_t buffersCount = 0;
+    if (sizeInBytes > 0) {
+        buffers[buffersCount++] = {const_cast<void *>(buffer), sizeInBytes};
+    }
+    if (extraSizeInBytes > 0) {
+        buffers[buffersCount++] = {const_cast<void *>(extraBuffer), extraSizeInBytes};
+    }
+
+    auto currentBuffer = buffers;
+    while (buffersCount > 0) {
+        auto bytesSent = ::writev(m_socket, currentBuffer, static_cast<int>(buffersCount));
+        if (bytesSent == 0 || bytesSent == WSAECONNRESET) {
+            logErrorInfo("Connection Closed.");
+            return false;
+        }
+
+        if (bytesSent == SOCKET_ERROR) {
+            logErrorInfo("Error on writev()");
+            return false;
+        }
+
+        auto bytesLeft = static_cast<size_t>(bytesSent);
+        while (buffersCount > 0 && bytesLeft >= currentBuffer->iov_len) {
+            bytesLeft -= currentBuffer->iov_len;
+            currentBuffer++;
+            buffersCount--;
+        }
+        if (buffersCount > 0) {
+            currentBuffer->iov_base = reinterpret_cast<char *>(currentBuffer->iov_base) + bytesLeft;
+            currentBuffer->iov_len -= bytesLeft;
+        }
+    }
+    return true;
+#endif
+}
+
 bool TbxSocketsImp::getResponseData(void *buffer, size_t sizeInBytes) {
     size_t totalRecv = 0;
     auto dataBuffer = static_cast<char *>(buffer);
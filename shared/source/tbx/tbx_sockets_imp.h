@@ -11,6 +11,7 @@
 #include "os_socket.h"
 
 #include <iostream>
+#include <vector>
 
 namespace NEO {
 
@@ -27,16 +28,32 @@ class TbxSocketsImp : public TbxSockets {
     bool readMemory(uint64_t offset, void *data, size_t size) override;
     bool writeMemory(uint64_t offset, const void *data, size_t size, uint32_t type) override;
 
+    bool readMemoryPipelined(const std::vector<MemoryRead> &reads) override;
+
     bool readMMIO(uint32_t offset, uint32_t *data) override;
     bool writeMMIO(uint32_t offset, uint32_t data) override;
 
+    static constexpr size_t maxPendingDataSize = 1024 * 1024;
+    static constexpr size_t maxCopiedWriteSize = 64 * 1024;
+    static constexpr size_t maxPipelinedReads = 32;
+
   protected:
     std::ostream &cerrStream;
     SOCKET m_socket = 0;
 
     bool connectToServer(const std::string &hostNameOrIp, uint16_t port);
     bool sendWriteData(const void *buffer, size_t sizeInBytes);
+    bool sendWriteDataVector(const void *buffer, size_t sizeInBytes, const void *extraBuffer, size_t extraSizeInBytes);
     bool getResponseData(void *buffer, size_t sizeInBytes);
+    bool getReadMemoryResponse(uint32_t transId, void *data, size_t size);
+
+    bool sendRequest(const void *request, size_t requestSize, const void *data, size_t dataSize);
+    bool flushPendingData(const void *extraData, size_t extraDataSize);
+
+    // in batched mode requests without a response are collected in pendingData and sent with a single call
+    // before a request which needs a response, an MMIO write or when the batch is full
+    bool batchedMode = false;
+    std::vector<char> pendingData;
 
     inline uint32_t getNextTransID() { return transID++; }
 
@@ -0,0 +1,275 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/binary_log_writer.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace NEO {
+
+namespace {
+std::atomic<uint64_t> nextWriterId{1u};
+
+struct WriterRegistry {
+    std::mutex mutex;
+    std::vector<BinaryLogWriter *> writers;
+};
+WriterRegistry &getWriterRegistry() {
+    static WriterRegistry registry;
+    return registry;
+}
+
+constexpr size_t maxPayloadSize = std::numeric_limits<uint16_t>::max();
+} // namespace
+
+thread_local BinaryLogWriter::ThreadBufferOwnership BinaryLogWriter::threadBufferOwnership;
+
+BinaryLogWriter::ThreadBufferOwnership::~ThreadBufferOwnership() {
+    release();
+}
+
+void BinaryLogWriter::ThreadBufferOwnership::release() {
+    if (buffer) {
+        buffer->owned.store(false, std::memory_order_release);
+        buffer.reset();
+    }
+    writerId = 0u;
+}
+
+BinaryLogWriter::BinaryLogWriter(const std::string &fileName, size_t threadBufferSize, std::chrono::milliseconds flushInterval)
+    : writerId(nextWriterId++), threadBufferSize(threadBufferSize), startTime(std::chrono::steady_clock::now()), flushInterval(flushInterval) {
+    file.open(fileName, std::ios::out | std::ios::trunc | std::ios::binary);
+    if (file.is_open()) {
+        file.write(BinaryLog::fileMagic, sizeof(BinaryLog::fileMagic));
+        file.write(reinterpret_cast<const char *>(&BinaryLog::fileVersion), sizeof(BinaryLog::fileVersion));
+    }
+    thread = Thread::create(flushThread, reinterpret_cast<void *>(this));
+
+    auto &registry = getWriterRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.writers.push_back(this);
+}
+
+BinaryLogWriter::~BinaryLogWriter() {
+    {
+        auto &registry = getWriterRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.writers.erase(std::remove(registry.writers.begin(), registry.writers.end(), this), registry.writers.end());
+    }
+    shutdown();
+
+    // no thread logs anymore, report drops which were not followed by any successful record
+    for (auto &buffer : threadBuffers) {
+        if (buffer->droppedSinceLastReport > 0u && push(*buffer, BinaryLog::RecordType::Dropped, &buffer->droppedSinceLastReport, sizeof(buffer->droppedSinceLastReport), nullptr, 0u)) {
+            buffer->droppedSinceLastReport = 0u;
+        }
+    }
+    flush();
+}
+
+void BinaryLogWriter::shutdownAll() {
+    auto &registry = getWriterRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (auto writer : registry.writers) {
+        writer->shutdown();
+    }
+}
+
+void BinaryLogWriter::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(flushMutex);
+        keepFlushing = false;
+    }
+    flushCondition.notify_all();
+    if (thread) {
+        thread->join();
+        thread.reset();
+    }
+    flush();
+}
+
+void BinaryLogWriter::logApiCall(const char *function, bool enter, int32_t errorCode) {
+    auto &buffer = getThreadBuffer();
+    uint32_t stringId = 0u;
+    if (!getStringId(buffer, function, stringId)) {
+        // the record would refer to a function name missing in the file
+        dropRecord(buffer);
+        return;
+    }
+    if (enter) {
+        pushRecord(buffer, BinaryLog::RecordType::ApiEnter, &stringId, sizeof(stringId), nullptr, 0u);
+    } else {
+        pushRecord(buffer, BinaryLog::RecordType::ApiLeave, &stringId, sizeof(stringId), &errorCode, sizeof(errorCode));
+    }
+}
+
+void BinaryLogWriter::logText(const char *str, size_t length) {
+    auto &buffer = getThreadBuffer();
+    do {
+        auto chunkSize = std::min(length, maxPayloadSize);
+        pushRecord(buffer, BinaryLog::RecordType::Text, str, chunkSize, nullptr, 0u);
+        str += chunkSize;
+        length -= chunkSize;
+    } while (length > 0u);
+}
+
+void BinaryLogWriter::flush() {
+    std::lock_guard<std::mutex> fileLock(fileMutex);
+
+    std::vector<ThreadBuffer *> buffers;
+    {
+        std::lock_guard<std::mutex> lock(threadBuffersMutex);
+        for (auto &buffer : threadBuffers) {
+            buffers.push_back(buffer.get());
+        }
+    }
+
+    for (auto buffer : buffers) {
+        auto read = buffer->readOffset.load(std::memory_order_relaxed);
+        auto write = buffer->writeOffset.load(std::memory_order_acquire);
+        if (read == write) {
+            continue;
+        }
+        if (file.is_open()) {
+            auto size = write - read;
+            auto position = read % buffer->capacity;
+            auto firstPart = std::min(size, buffer->capacity - position);
+            file.write(reinterpret_cast<const char *>(buffer->data.get() + position), firstPart);
+            file.write(reinterpret_cast<const char *>(buffer->data.get()), size - firstPart);
+        }
+        buffer->readOffset.store(write, std::memory_order_release);
+    }
+
+    if (file.is_open()) {
+        file.flush();
+    }
+}
+
+uint64_t BinaryLogWriter::getDroppedRecordsCount() {
+    std::lock_guard<std::mutex> lock(threadBuffersMutex);
+    uint64_t droppedRecords = 0u;
+    for (auto &buffer : threadBuffers) {
+        droppedRecords += buffer->droppedRecords.load(std::memory_order_relaxed);
+    }
+    return droppedRecords;
+}
+
+BinaryLogWriter::ThreadBuffer &BinaryLogWriter::getThreadBuffer() {
+    if (threadBufferOwnership.writerId == writerId) {
+        return *threadBufferOwnership.buffer;
+    }
+    threadBufferOwnership.release();
+
+    std::shared_ptr<ThreadBuffer> threadBuffer;
+    {
+        std::lock_guard<std::mutex> lock(threadBuffersMutex);
+        for (auto &buffer : threadBuffers) {
+            bool owned = false;
+            if (buffer->owned.compare_exchange_strong(owned, true, std::memory_order_acquire)) {
+                threadBuffer = buffer;
+                break;
+            }
+        }
+        if (threadBuffer == nullptr) {
+            threadBuffer = std::make_shared<ThreadBuffer>();
+            threadBuffer->data = std::make_unique<uint8_t[]>(threadBufferSize);
+            threadBuffer->capacity = threadBufferSize;
+            threadBuffer->threadIndex = static_cast<uint32_t>(threadBuffers.size());
+            threadBuffer->owned.store(true, std::memory_order_relaxed);
+            threadBuffers.push_back(threadBuffer);
+        }
+    }
+
+    threadBufferOwnership.writerId = writerId;
+    threadBufferOwnership.buffer = threadBuffer;
+
+    // a reused ring keeps the strings of its previous thread, records from now on belong to this thread
+    uint64_t osThreadIdHash = std::hash<std::thread::id>()(std::this_thread::get_id());
+    pushRecord(*threadBuffer, BinaryLog::RecordType::ThreadStart, &osThreadIdHash, sizeof(osThreadIdHash), nullptr, 0u);
+    return *threadBuffer;
+}
+
+bool BinaryLogWriter::getStringId(ThreadBuffer &buffer, const char *str, uint32_t &stringId) {
+    auto it = buffer.stringIds.find(str);
+    if (it != buffer.stringIds.end()) {
+        stringId = it->second;
+        return true;
+    }
+    stringId = static_cast<uint32_t>(buffer.stringIds.size());
+    auto length = std::min(strlen(str), maxPayloadSize - sizeof(stringId));
+    if (!pushRecord(buffer, BinaryLog::RecordType::String, &stringId, sizeof(stringId), str, length)) {
+        return false;
+    }
+    buffer.stringIds.insert({str, stringId});
+    return true;
+}
+
+void BinaryLogWriter::dropRecord(ThreadBuffer &buffer) {
+    buffer.droppedSinceLastReport++;
+    buffer.droppedRecords.fetch_add(1u, std::memory_order_relaxed);
+}
+
+bool BinaryLogWriter::pushRecord(ThreadBuffer &buffer, BinaryLog::RecordType type, const void *payload, size_t payloadSize, const void *payloadTail, size_t payloadTailSize) {
+    if (buffer.droppedSinceLastReport > 0u) {
+        if (push(buffer, BinaryLog::RecordType::Dropped, &buffer.droppedSinceLastReport, sizeof(buffer.droppedSinceLastReport), nullptr, 0u)) {
+            buffer.droppedSinceLastReport = 0u;
+        }
+    }
+    if (buffer.droppedSinceLastReport == 0u && push(buffer, type, payload, payloadSize, payloadTail, payloadTailSize)) {
+        return true;
+    }
+    dropRecord(buffer);
+    return false;
+}
+
+bool BinaryLogWriter::push(ThreadBuffer &buffer, BinaryLog::RecordType type, const void *payload, size_t payloadSize, const void *payloadTail, size_t payloadTailSize) {
+    auto recordSize = sizeof(BinaryLog::RecordHeader) + payloadSize + payloadTailSize;
+    auto write = buffer.writeOffset.load(std::memory_order_relaxed);
+    auto read = buffer.readOffset.load(std::memory_order_acquire);
+    if (recordSize > buffer.capacity - (write - read)) {
+        return false;
+    }
+
+    BinaryLog::RecordHeader header = {};
+    header.type = static_cast<uint16_t>(type);
+    header.payloadSize = static_cast<uint16_t>(payloadSize + payloadTailSize);
+    header.threadIndex = buffer.threadIndex;
+    header.timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count());
+
+    copyToRing(buffer, write, &header, sizeof(header));
+    copyToRing(buffer, write + sizeof(header), payload, payloadSize);
+    copyToRing(buffer, write + sizeof(header) + payloadSize, payloadTail, payloadTailSize);
+    buffer.writeOffset.store(write + recordSize, std::memory_order_release);
+    return true;
+}
+
+void BinaryLogWriter::copyToRing(ThreadBuffer &buffer, size_t offset, const void *src, size_t size) {
+    if (size == 0u) {
+        return;
+    }
+    auto position = offset % buffer.capacity;
+    auto firstPart = std::min(size, buffer.capacity - position);
+    memcpy(buffer.data.get() + position, src, firstPart);
+    memcpy(buffer.data.get(), reinterpret_cast<const uint8_t *>(src) + firstPart, size - firstPart);
+}
+
+void *BinaryLogWriter::flushThread(void *self) {
+    auto writer = reinterpret_cast<BinaryLogWriter *>(self);
+    std::unique_lock<std::mutex> lock(writer->flushMutex);
+    while (!writer->flushCondition.wait_for(lock, writer->flushInterval, [writer] { return !writer->keepFlushing; })) {
+        lock.unlock();
+        writer->flush();
+        lock.lock();
+    }
+    return nullptr;
+}
+
+} // namespace NEO
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// File layout: fileMagic, uint32_t fileVersion, then records.
+// Every record is a RecordHeader followed by payloadSize bytes, all fields little endian.
+// scripts/decode_binary_log.py converts the file back to text.
+namespace BinaryLog {
+constexpr char fileMagic[8] = "NEOBLOG";
+constexpr uint32_t fileVersion = 1u;
+
+enum class RecordType : uint16_t {
+    ThreadStart = 0, // uint64_t hash of the OS thread id
+    String = 1,      // uint32_t string id, characters without terminator
+    ApiEnter = 2,    // uint32_t string id of the function name
+    ApiLeave = 3,    // uint32_t string id of the function name, int32_t error code
+    Text = 4,        // characters of an already formatted message
+    Dropped = 5,     // uint64_t number of records lost because the thread buffer was full
+};
+
+#pragma pack(push, 1)
+struct RecordHeader {
+    uint16_t type;
+    uint16_t payloadSize;
+    uint32_t threadIndex;
+    uint64_t timestamp;
+};
+#pragma pack(pop)
+static_assert(sizeof(RecordHeader) == 16, "record header size is part of the file format");
+} // namespace BinaryLog
+
+// Each logging thread appends records to its own ring buffer without taking locks,
+// a background thread drains all buffers to the file, which stays open for the lifetime of the writer.
+// Records not fitting into the ring are dropped and accounted for by a Dropped record.
+// A ring is handed back to the writer when its thread exits and is reused by the next logging thread.
+// The background thread is stopped by shutdown(), which driver teardown calls through shutdownAll();
+// records logged afterwards are written when the writer is destroyed.
+class BinaryLogWriter : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t defaultThreadBufferSize = 256 * 1024;
+    static constexpr uint32_t defaultFlushIntervalMs = 100u;
+
+    BinaryLogWriter(const std::string &fileName, size_t threadBufferSize, std::chrono::milliseconds flushInterval);
+    MOCKABLE_VIRTUAL ~BinaryLogWriter();
+
+    static void shutdownAll();
+
+    bool isOpen() const { return file.is_open(); }
+    void shutdown();
+
+    void logApiCall(const char *function, bool enter, int32_t errorCode);
+    void logText(const char *str, size_t length);
+    void flush();
+
+    uint64_t getDroppedRecordsCount();
+
+  protected:
+    struct ThreadBuffer {
+        std::unique_ptr<uint8_t[]> data;
+        size_t capacity = 0u;
+        std::atomic<size_t> writeOffset{0u};
+        std::atomic<size_t> readOffset{0u};
+        uint32_t threadIndex = 0u;
+        std::atomic<bool> owned{false};
+
+        // accessed by the owning thread only
+        std::unordered_map<const char *, uint32_t> stringIds;
+        uint64_t droppedSinceLastReport = 0u;
+        std::atomic<uint64_t> droppedRecords{0u};
+    };
+
+    // Holds the ring of the current thread, hands it back to its writer when the thread exits.
+    struct ThreadBufferOwnership {
+        ~ThreadBufferOwnership();
+        void release();
+
+        uint64_t writerId = 0u;
+        std::shared_ptr<ThreadBuffer> buffer;
+    };
+    static thread_local ThreadBufferOwnership threadBufferOwnership;
+
+    ThreadBuffer &getThreadBuffer();
+    bool push(ThreadBuffer &buffer, BinaryLog::RecordType type, const void *payload, size_t payloadSize, const void *payloadTail, size_t payloadTailSize);
+    bool pushRecord(ThreadBuffer &buffer, BinaryLog::RecordType type, const void *payload, size_t payloadSize, const void *payloadTail, size_t payloadTailSize);
+    bool getStringId(ThreadBuffer &buffer, const char *str, uint32_t &stringId);
+    void dropRecord(ThreadBuffer &buffer);
+    void copyToRing(ThreadBuffer &buffer, size_t offset, const void *src, size_t size);
+
+    static void *flushThread(void *self);
+
+    const uint64_t writerId;
+    const size_t threadBufferSize;
+    const std::chrono::steady_clock::time_point startTime;
+
+    std::vector<std::shared_ptr<ThreadBuffer>> threadBuffers;
+    std::mutex threadBuffersMutex;
+
+    std::ofstream file;
+    std::mutex fileMutex;
+
+    std::chrono::milliseconds flushInterval;
+    std::unique_ptr<Thread> thread;
+    bool keepFlushing = true;
+    std::mutex flushMutex;
+    std::condition_variable flushCondition;
+};
+} // namespace NEO
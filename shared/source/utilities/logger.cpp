@@ -9,6 +9,7 @@
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/timestamp_packet.h"
+#include "shared/source/utilities/binary_log_writer.h"
 
 #include <memory>
 #include <string>
@@ -30,6 +31,10 @@ FileLogger<DebugLevel>::FileLogger(std::string filename, const DebugVariables &f
     logAllocationMemoryPool = flags.LogAllocationMemoryPool.get();
     logAllocationType = flags.LogAllocationType.get();
     logAllocationStdout = flags.LogAllocationStdout.get();
+
+    if (enabled() && logApiCalls && flags.LogApiCallsBinary.get()) {
+        binaryLogWriter = std::make_unique<BinaryLogWriter>(logFileName, BinaryLogWriter::defaultThreadBufferSize, std::chrono::milliseconds(BinaryLogWriter::defaultFlushIntervalMs));
+    }
 }
 
 template <DebugFunctionalityLevel DebugLevel>
@@ -37,6 +42,10 @@ FileLogger<DebugLevel>::~FileLogger() = default;
 
 template <DebugFunctionalityLevel DebugLevel>
 void FileLogger<DebugLevel>::writeToFile(std::string filename, const char *str, size_t length, std::ios_base::openmode mode) {
+    if (binaryLogWriter && filename == logFileName) {
+        binaryLogWriter->logText(str, length);
+        return;
+    }
     std::unique_lock<std::mutex> theLock(mutex);
     std::ofstream outFile(filename, mode);
     if (outFile.is_open()) {
@@ -64,6 +73,10 @@ void FileLogger<DebugLevel>::logApiCall(const char *function, bool enter, int32_
     }
 
     if (logApiCalls) {
+        if (binaryLogWriter) {
+            binaryLogWriter->logApiCall(function, enter, errorCode);
+            return;
+        }
         std::thread::id thisThread = std::this_thread::get_id();
 
         std::stringstream ss;
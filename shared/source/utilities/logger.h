@@ -17,6 +17,7 @@
 #include <string>
 
 namespace NEO {
+class BinaryLogWriter;
 class Kernel;
 struct MultiDispatchInfo;
 
@@ -138,6 +139,7 @@ class FileLogger {
   protected:
     std::mutex mutex;
     std::string logFileName;
+    std::unique_ptr<BinaryLogWriter> binaryLogWriter;
     bool dumpKernels = false;
     bool logApiCalls = false;
     bool logAllocationMemoryPool = false;
@@ -0,0 +1,217 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/trace_recorder.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/os_interface/os_time.h"
+
+#include <cinttypes>
+#include <cstdio>
+
+namespace NEO {
+
+namespace {
+std::atomic<uint32_t> nextThreadId{1u};
+
+std::string escapeJsonString(const char *str) {
+    std::string escaped;
+    for (; str && *str; str++) {
+        if (*str == '"' || *str == '\\') {
+            escaped += '\\';
+        }
+        if (static_cast<unsigned char>(*str) >= 0x20) {
+            escaped += *str;
+        }
+    }
+    return escaped;
+}
+
+std::string formatMicroseconds(uint64_t ns) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%" PRIu64 ".%03" PRIu64, ns / 1000u, ns % 1000u);
+    return buffer;
+}
+} // namespace
+
+TraceRecorder *TraceRecorder::get() {
+    // Never destroyed, so API calls made during static destruction still find it
+    static TraceRecorder *traceRecorder = create().release();
+    return traceRecorder;
+}
+
+void TraceRecorder::shutdownGlobal() {
+    auto traceRecorder = get();
+    if (traceRecorder) {
+        traceRecorder->shutdown();
+    }
+}
+
+std::unique_ptr<TraceRecorder> TraceRecorder::create() {
+    if (DebugManager.flags.ChromeTraceFile.get() == "unk") {
+        return nullptr;
+    }
+    size_t maxBufferedEvents = defaultMaxBufferedEvents;
+    if (DebugManager.flags.ChromeTraceBufferedEvents.get() > 0) {
+        maxBufferedEvents = static_cast<size_t>(DebugManager.flags.ChromeTraceBufferedEvents.get());
+    }
+    return std::make_unique<TraceRecorder>(DebugManager.flags.ChromeTraceFile.get(), maxBufferedEvents, OSTime::create(nullptr));
+}
+
+TraceRecorder::TraceRecorder(const std::string &fileName, size_t maxBufferedEvents, std::unique_ptr<OSTime> osTime)
+    : osTime(std::move(osTime)), maxBufferedEvents(maxBufferedEvents) {
+    events.reserve(maxBufferedEvents);
+    pendingEvents.reserve(maxBufferedEvents);
+    file.open(fileName, std::ios::out | std::ios::trunc);
+    if (file.is_open()) {
+        file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+        file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << static_cast<uint32_t>(Track::Host) << ",\"args\":{\"name\":\"Host\"}},\n";
+        file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << static_cast<uint32_t>(Track::Gpu) << ",\"args\":{\"name\":\"GPU\"}}";
+        firstEventWritten = true;
+    }
+    thread = Thread::create(writerThread, reinterpret_cast<void *>(this));
+}
+
+TraceRecorder::~TraceRecorder() {
+    shutdown();
+}
+
+void TraceRecorder::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(eventsMutex);
+        keepRunning = false;
+    }
+    eventsAvailable.notify_all();
+    if (thread) {
+        thread->join();
+        thread.reset();
+    }
+
+    // Events left behind by the writer thread are written here, without waiting for it
+    std::lock_guard<std::mutex> lock(eventsMutex);
+    writerStopped = true;
+    writeEvents(pendingEvents);
+    pendingEvents.clear();
+    eventsConsumed.notify_all();
+    writeEvents(events);
+    events.clear();
+    if (file.is_open()) {
+        file << "\n]}\n";
+        file.close();
+    }
+}
+
+uint64_t TraceRecorder::getCpuTimestamp() {
+    uint64_t timestamp = 0u;
+    osTime->getCpuTime(&timestamp);
+    return timestamp;
+}
+
+void TraceRecorder::recordHostInterval(const char *category, const char *name, uint64_t startNs, uint64_t endNs) {
+    Event event;
+    event.category = category;
+    event.name = name;
+    event.track = Track::Host;
+    event.threadId = getCurrentThreadId();
+    event.startNs = startNs;
+    event.endNs = endNs;
+    record(std::move(event));
+}
+
+void TraceRecorder::recordGpuInterval(const std::string &name, uint32_t engineId, uint64_t startNs, uint64_t endNs) {
+    Event event;
+    event.category = "gpu";
+    event.ownedName = name;
+    event.track = Track::Gpu;
+    event.threadId = engineId;
+    event.startNs = startNs;
+    event.endNs = endNs;
+    record(std::move(event));
+}
+
+void TraceRecorder::flush() {
+    {
+        std::unique_lock<std::mutex> lock(eventsMutex);
+        if (!events.empty()) {
+            submitEvents(lock);
+        }
+    }
+    waitForPendingEvents();
+}
+
+uint32_t TraceRecorder::getCurrentThreadId() {
+    static thread_local uint32_t threadId = nextThreadId++;
+    return threadId;
+}
+
+void TraceRecorder::record(Event &&event) {
+    std::unique_lock<std::mutex> lock(eventsMutex);
+    events.push_back(std::move(event));
+    if (events.size() >= maxBufferedEvents) {
+        submitEvents(lock);
+    }
+}
+
+void TraceRecorder::submitEvents(std::unique_lock<std::mutex> &lock) {
+    if (writerStopped) {
+        writeEvents(events);
+        events.clear();
+        return;
+    }
+    // bounds memory use when events are recorded faster than they are written
+    eventsConsumed.wait(lock, [this] { return pendingEvents.empty(); });
+    events.swap(pendingEvents);
+    eventsAvailable.notify_one();
+}
+
+void TraceRecorder::waitForPendingEvents() {
+    std::unique_lock<std::mutex> lock(eventsMutex);
+    eventsConsumed.wait(lock, [this] { return pendingEvents.empty(); });
+}
+
+void TraceRecorder::writeEvents(const std::vector<Event> &eventsToWrite) {
+    if (!file.is_open()) {
+        return;
+    }
+    for (auto &event : eventsToWrite) {
+        if (firstEventWritten) {
+            file << ",\n";
+        }
+        firstEventWritten = true;
+        auto duration = event.endNs > event.startNs ? event.endNs - event.startNs : 0u;
+        file << "{\"name\":\"" << escapeJsonString(event.name ? event.name : event.ownedName.c_str())
+             << "\",\"cat\":\"" << escapeJsonString(event.category)
+             << "\",\"ph\":\"X\",\"ts\":" << formatMicroseconds(event.startNs)
+             << ",\"dur\":" << formatMicroseconds(duration)
+             << ",\"pid\":" << static_cast<uint32_t>(event.track)
+             << ",\"tid\":" << event.threadId << "}";
+    }
+    file.flush();
+}
+
+void *TraceRecorder::writerThread(void *self) {
+    auto recorder = reinterpret_cast<TraceRecorder *>(self);
+    std::unique_lock<std::mutex> lock(recorder->eventsMutex);
+    while (true) {
+        recorder->eventsAvailable.wait(lock, [recorder] { return !recorder->pendingEvents.empty() || !recorder->keepRunning; });
+        if (recorder->pendingEvents.empty()) {
+            break;
+        }
+        // recording threads do not touch pendingEvents until it is empty again
+        lock.unlock();
+
+        recorder->writeEvents(recorder->pendingEvents);
+
+        lock.lock();
+        recorder->pendingEvents.clear();
+        recorder->eventsConsumed.notify_all();
+    }
+    return nullptr;
+}
+
+} // namespace NEO
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace NEO {
+class OSTime;
+class Thread;
+
+// Records host intervals (API calls, submissions, waits) and GPU intervals in Chrome trace event format,
+// loadable by chrome://tracing and ui.perfetto.dev.
+// All timestamps are CPU nanoseconds of OSTime, the clock used by getCpuGpuTime for GPU timestamp correlation.
+// Events are double buffered: a full buffer of maxBufferedEvents is handed to a background thread,
+// which formats and writes it while recording threads fill the other one.
+// The background thread is stopped by shutdown(), which driver teardown calls through shutdownGlobal();
+// it writes the events left behind on the calling thread and completes the file, later events are dropped.
+class TraceRecorder : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t defaultMaxBufferedEvents = 16384u;
+
+    enum class Track : uint32_t {
+        Host = 1,
+        Gpu = 2,
+    };
+
+    static TraceRecorder *get();
+    static void shutdownGlobal();
+
+    TraceRecorder(const std::string &fileName, size_t maxBufferedEvents, std::unique_ptr<OSTime> osTime);
+    MOCKABLE_VIRTUAL ~TraceRecorder();
+
+    bool isOpen() const { return file.is_open(); }
+
+    uint64_t getCpuTimestamp();
+    void recordHostInterval(const char *category, const char *name, uint64_t startNs, uint64_t endNs);
+    void recordGpuInterval(const std::string &name, uint32_t engineId, uint64_t startNs, uint64_t endNs);
+    void flush();
+    void shutdown();
+
+  protected:
+    struct Event {
+        const char *category = nullptr;
+        const char *name = nullptr;
+        std::string ownedName;
+        Track track = Track::Host;
+        uint32_t threadId = 0u;
+        uint64_t startNs = 0u;
+        uint64_t endNs = 0u;
+    };
+
+    static std::unique_ptr<TraceRecorder> create();
+    static uint32_t getCurrentThreadId();
+
+    void record(Event &&event);
+    void submitEvents(std::unique_lock<std::mutex> &lock);
+    void waitForPendingEvents();
+    void writeEvents(const std::vector<Event> &eventsToWrite);
+    static void *writerThread(void *self);
+
+    std::unique_ptr<OSTime> osTime;
+    const size_t maxBufferedEvents;
+
+    std::vector<Event> events;
+    std::vector<Event> pendingEvents;
+    bool keepRunning = true;
+    bool writerStopped = false;
+    std::mutex eventsMutex;
+    std::condition_variable eventsAvailable;
+    std::condition_variable eventsConsumed;
+    std::unique_ptr<Thread> thread;
+
+    // accessed by the writer thread while it runs, under eventsMutex once it is stopped
+    std::ofstream file;
+    bool firstEventWritten = false;
+};
+
+class TraceScope : NonCopyableOrMovableClass {
+  public:
+    TraceScope(const char *category, const char *name) : recorder(TraceRecorder::get()) {
+        if (recorder) {
+            this->category = category;
+            this->name = name;
+            startNs = recorder->getCpuTimestamp();
+        }
+    }
+    ~TraceScope() {
+        if (recorder) {
+            recorder->recordHostInterval(category, name, startNs, recorder->getCpuTimestamp());
+        }
+    }
+
+  protected:
+    TraceRecorder *recorder;
+    const char *category = nullptr;
+    const char *name = nullptr;
+    uint64_t startNs = 0u;
+};
+} // namespace NEO
@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/os_interface/linux/loopback_tbx_server.h"
+
+#include "shared/source/tbx/tbx_proto.h"
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cstring>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace NEO {
+
+LoopbackTbxServer::~LoopbackTbxServer() {
+    stop();
+}
+
+bool LoopbackTbxServer::start() {
+    listenSocket = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (listenSocket < 0) {
+        return false;
+    }
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    socklen_t addressLength = sizeof(address);
+    if (::bind(listenSocket, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 ||
+        ::listen(listenSocket, 1) != 0 ||
+        ::getsockname(listenSocket, reinterpret_cast<sockaddr *>(&address), &addressLength) != 0) {
+        ::close(listenSocket);
+        listenSocket = -1;
+        return false;
+    }
+    port = ntohs(address.sin_port);
+
+    serverThread = std::thread([this] { serve(); });
+    return true;
+}
+
+void LoopbackTbxServer::stop() {
+    if (listenSocket >= 0) {
+        // unblocks accept when no client connected, a connected client is served until it closes the connection
+        ::shutdown(listenSocket, SHUT_RDWR);
+    }
+    if (serverThread.joinable()) {
+        serverThread.join();
+    }
+    if (listenSocket >= 0) {
+        ::close(listenSocket);
+        listenSocket = -1;
+    }
+}
+
+std::vector<uint8_t> LoopbackTbxServer::getMemory(uint64_t address, size_t size) {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<uint8_t> data(size);
+    readMemory(address, data.data(), size);
+    return data;
+}
+
+uint32_t LoopbackTbxServer::getMmio(uint32_t offset) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return mmio[offset];
+}
+
+uint64_t LoopbackTbxServer::getGttEntry(uint32_t index) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return gtt[index];
+}
+
+size_t LoopbackTbxServer::getRequestsCount(uint32_t msgType) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return requestsCount[msgType];
+}
+
+uint64_t LoopbackTbxServer::getReceivedBytes() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return receivedBytes;
+}
+
+void LoopbackTbxServer::serve() {
+    auto connection = ::accept(listenSocket, nullptr, nullptr);
+    if (connection < 0) {
+        return;
+    }
+    int noDelay = 1;
+    ::setsockopt(connection, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+    std::vector<uint8_t> data;
+    HAS_MSG cmd;
+    while (receive(connection, &cmd.hdr, sizeof(cmd.hdr))) {
+        if (cmd.hdr.size > sizeof(cmd.u) || !receive(connection, &cmd.u, cmd.hdr.size)) {
+            break;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            requestsCount[cmd.hdr.msg_type]++;
+        }
+
+        if (cmd.hdr.msg_type == HAS_WRITE_DATA_REQ_TYPE) {
+            auto address = (static_cast<uint64_t>(cmd.u.write_req.address_h) << 32) | cmd.u.write_req.address;
+            data.resize(cmd.u.write_req.size);
+            if (!receive(connection, data.data(), data.size())) {
+                break;
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            writeMemory(address, data.data(), data.size());
+        } else if (cmd.hdr.msg_type == HAS_READ_DATA_REQ_TYPE) {
+            auto address = (static_cast<uint64_t>(cmd.u.read_req.address_h) << 32) | cmd.u.read_req.address;
+            HAS_MSG resp = {};
+            resp.hdr.msg_type = HAS_READ_DATA_RES_TYPE;
+            resp.hdr.trans_id = cmd.hdr.trans_id;
+            resp.hdr.size = sizeof(HAS_READ_DATA_RES);
+            resp.u.read_res.address = cmd.u.read_req.address;
+            resp.u.read_res.address_h = cmd.u.read_req.address_h;
+            resp.u.read_res.size = cmd.u.read_req.size;
+            // response header and data go out in a single send
+            constexpr size_t responseSize = sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_RES);
+            data.resize(responseSize + cmd.u.read_req.size);
+            memcpy(data.data(), &resp, responseSize);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                readMemory(address, data.data() + responseSize, cmd.u.read_req.size);
+            }
+            if (!sendAll(connection, data.data(), data.size())) {
+                break;
+            }
+        } else if (cmd.hdr.msg_type == HAS_MMIO_REQ_TYPE) {
+            if (cmd.u.mmio_req.write) {
+                std::lock_guard<std::mutex> lock(mutex);
+                mmio[cmd.u.mmio_req.offset] = cmd.u.mmio_req.data;
+                continue;
+            }
+            HAS_MSG resp = {};
+            resp.hdr.msg_type = HAS_MMIO_RES_TYPE;
+            resp.hdr.trans_id = cmd.hdr.trans_id;
+            resp.hdr.size = sizeof(HAS_MMIO_RES);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                resp.u.mmio_res.data = mmio[cmd.u.mmio_req.offset];
+            }
+            if (!sendAll(connection, &resp, sizeof(HAS_HDR) + sizeof(HAS_MMIO_RES))) {
+                break;
+            }
+        } else if (cmd.hdr.msg_type == HAS_GTT_REQ_TYPE && cmd.u.gtt64_req.write) {
+            std::lock_guard<std::mutex> lock(mutex);
+            gtt[cmd.u.gtt64_req.offset] = (static_cast<uint64_t>(cmd.u.gtt64_req.data_h) << 32) | cmd.u.gtt64_req.data;
+        }
+    }
+    ::close(connection);
+}
+
+bool LoopbackTbxServer::receive(int connection, void *buffer, size_t size) {
+    auto bytes = reinterpret_cast<char *>(buffer);
+    while (size > 0) {
+        auto received = ::recv(connection, bytes, size, 0);
+        if (received <= 0) {
+            return false;
+        }
+        bytes += received;
+        size -= received;
+        std::lock_guard<std::mutex> lock(mutex);
+        receivedBytes += received;
+    }
+    return true;
+}
+
+bool LoopbackTbxServer::sendAll(int connection, const void *buffer, size_t size) {
+    auto bytes = reinterpret_cast<const char *>(buffer);
+    while (size > 0) {
+        auto sent = ::send(connection, bytes, size, MSG_NOSIGNAL);
+        if (sent <= 0) {
+            return false;
+        }
+        bytes += sent;
+        size -= sent;
+    }
+    return true;
+}
+
+void LoopbackTbxServer::writeMemory(uint64_t address, const uint8_t *data, size_t size) {
+    while (size > 0) {
+        auto &page = pages[address / pageSize];
+        page.resize(pageSize);
+        auto offset = address % pageSize;
+        auto chunkSize = std::min(size, pageSize - offset);
+        memcpy(page.data() + offset, data, chunkSize);
+        address += chunkSize;
+        data += chunkSize;
+        size -= chunkSize;
+    }
+}
+
+void LoopbackTbxServer::readMemory(uint64_t address, uint8_t *data, size_t size) {
+    while (size > 0) {
+        auto offset = address % pageSize;
+        auto chunkSize = std::min(size, pageSize - offset);
+        auto page = pages.find(address / pageSize);
+        if (page != pages.end()) {
+            memcpy(data, page->second.data() + offset, chunkSize);
+        } else {
+            memset(data, 0, chunkSize);
+        }
+        address += chunkSize;
+        data += chunkSize;
+        size -= chunkSize;
+    }
+}
+
+} // namespace NEO
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+// Stand-in for a TBX server listening on the loopback interface. Memory, MMIO and GTT writes are kept in host
+// storage and served back to reads, so TbxSocketsImp can be exercised and its throughput measured without a simulator.
+class LoopbackTbxServer : NonCopyableOrMovableClass {
+  public:
+    ~LoopbackTbxServer();
+
+    bool start();
+    void stop();
+    uint16_t getPort() const { return port; }
+
+    std::vector<uint8_t> getMemory(uint64_t address, size_t size);
+    uint32_t getMmio(uint32_t offset);
+    uint64_t getGttEntry(uint32_t index);
+    size_t getRequestsCount(uint32_t msgType);
+    uint64_t getReceivedBytes();
+
+  protected:
+    static constexpr size_t pageSize = 4096;
+
+    void serve();
+    bool receive(int connection, void *buffer, size_t size);
+    bool sendAll(int connection, const void *buffer, size_t size);
+    void writeMemory(uint64_t address, const uint8_t *data, size_t size);
+    void readMemory(uint64_t address, uint8_t *data, size_t size);
+
+    int listenSocket = -1;
+    uint16_t port = 0;
+    std::thread serverThread;
+
+    std::mutex mutex;
+    std::map<uint64_t, std::vector<uint8_t>> pages;
+    std::map<uint32_t, uint32_t> mmio;
+    std::map<uint32_t, uint64_t> gtt;
+    std::map<uint32_t, size_t> requestsCount;
+    uint64_t receivedBytes = 0u;
+};
+
+} // namespace NEO
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/aub_mem_dump/aub_compressed_file_writer.h"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace AubMemDump;
+
+namespace {
+std::vector<char> createAubLikeData() {
+    std::vector<char> data;
+    for (uint32_t i = 0; i < 64; i++) {
+        data.push_back(static_cast<char>(i * 7));
+    }
+    data.insert(data.end(), 4096, 0);
+    for (uint32_t i = 0; i < 1000; i++) {
+        data.push_back(static_cast<char>(i * 31 + (i >> 3)));
+    }
+    data.insert(data.end(), 8192, static_cast<char>(0xab));
+    data.push_back(1);
+    data.push_back(2);
+    data.push_back(3);
+    return data;
+}
+} // namespace
+
+TEST(AubCompressedFileWriterTest, givenRepeatedDwordsWhenCompressingBlockThenBlockIsShrunkAndExpandsToOriginalData) {
+    auto data = createAubLikeData();
+
+    std::vector<char> compressed;
+    auto codec = CompressedAub::compressBlock(data.data(), data.size(), compressed);
+    EXPECT_EQ(CompressedAub::BlockCodec::DwordRle, codec);
+    EXPECT_LT(compressed.size(), data.size() / 4);
+
+    std::vector<char> expanded;
+    EXPECT_TRUE(CompressedAub::expandBlock(codec, compressed.data(), compressed.size(), data.size(), expanded));
+    EXPECT_EQ(data, expanded);
+
+    compressed.pop_back();
+    EXPECT_FALSE(CompressedAub::expandBlock(codec, compressed.data(), compressed.size(), data.size(), expanded));
+}
+
+TEST(AubCompressedFileWriterTest, givenIncompressibleDataWhenCompressingBlockThenBlockIsStored) {
+    std::vector<char> data;
+    for (uint32_t i = 0; i < 1027; i++) {
+        data.push_back(static_cast<char>(i * 131 + 17));
+    }
+
+    std::vector<char> compressed;
+    auto codec = CompressedAub::compressBlock(data.data(), data.size(), compressed);
+    EXPECT_EQ(CompressedAub::BlockCodec::Stored, codec);
+    EXPECT_EQ(data, compressed);
+}
+
+TEST(AubCompressedFileWriterTest, givenWritesSpanningBlocksWhenWriterIsDestroyedThenExpandedFileMatchesWrittenStream) {
+    auto data = createAubLikeData();
+    std::ostringstream output;
+    std::string expected;
+    {
+        AubCompressedFileWriter writer(output, 4096u);
+        for (uint32_t i = 0; i < 8; i++) {
+            writer.write(data.data(), data.size());
+            expected.append(data.data(), data.size());
+        }
+        writer.flush();
+        EXPECT_LT(output.str().size(), expected.size());
+        writer.write("tail", 4u);
+        expected.append("tail");
+    }
+
+    auto compressed = output.str();
+    EXPECT_EQ(0, compressed.compare(0, sizeof(CompressedAub::fileMagic), CompressedAub::fileMagic, sizeof(CompressedAub::fileMagic)));
+
+    std::istringstream input(compressed);
+    std::ostringstream expanded;
+    EXPECT_TRUE(CompressedAub::expand(input, expanded));
+    EXPECT_EQ(expected, expanded.str());
+
+    std::istringstream truncatedInput(compressed.substr(0, compressed.size() - 1));
+    std::ostringstream truncatedExpanded;
+    EXPECT_FALSE(CompressedAub::expand(truncatedInput, truncatedExpanded));
+}
@@ -188,7 +188,7 @@ TEST_F(CommandContainerTest, givenCmdContainerWithAllocsListWhenAllocateAndReset
     auto cmdBuffer1 = cmdBufferAllocs[1];
 
     cmdContainer->reset();
-    EXPECT_EQ(memoryManager->handleFenceCompletionCalled, 1u);
+    EXPECT_EQ(memoryManager->handleFenceCompletionCalled, 0u);
     EXPECT_EQ(cmdBufferAllocs.size(), 1u);
     EXPECT_EQ(cmdBufferAllocs[0], cmdBuffer0);
     EXPECT_FALSE(allocList.peekIsEmpty());
@@ -200,11 +200,77 @@ TEST_F(CommandContainerTest, givenCmdContainerWithAllocsListWhenAllocateAndReset
     EXPECT_TRUE(allocList.peekIsEmpty());
 
     cmdContainer.reset();
-    EXPECT_EQ(memoryManager->handleFenceCompletionCalled, 3u);
+    EXPECT_EQ(memoryManager->handleFenceCompletionCalled, 0u);
     EXPECT_FALSE(allocList.peekIsEmpty());
     allocList.freeAllGraphicsAllocations(pDevice);
 }
 
+TEST_F(CommandContainerTest, givenCmdContainerWithAllocsListWhenDestroyedAndCreatedAgainThenCmdBufferAndHeapAllocsAreReused) {
+    AllocationsList allocList;
+    auto cmdContainer = std::make_unique<CommandContainer>();
+    cmdContainer->initialize(pDevice, &allocList);
+    auto cmdBuffer = cmdContainer->getCmdBufferAllocations()[0];
+    auto dsh = cmdContainer->getIndirectHeapAllocation(HeapType::DYNAMIC_STATE);
+    auto ioh = cmdContainer->getIndirectHeapAllocation(HeapType::INDIRECT_OBJECT);
+
+    cmdContainer.reset(new CommandContainer);
+    EXPECT_FALSE(allocList.peekIsEmpty());
+    cmdContainer->initialize(pDevice, &allocList);
+
+    EXPECT_EQ(cmdBuffer, cmdContainer->getCmdBufferAllocations()[0]);
+    bool dshReused = false;
+    for (uint32_t i = 0; i < HeapType::NUM_TYPES; i++) {
+        dshReused |= (cmdContainer->getIndirectHeapAllocation(static_cast<HeapType>(i)) == dsh);
+    }
+    EXPECT_TRUE(dshReused);
+    EXPECT_EQ(ioh, cmdContainer->getIndirectHeapAllocation(HeapType::INDIRECT_OBJECT));
+
+    cmdContainer.reset();
+    allocList.freeAllGraphicsAllocations(pDevice);
+}
+
+TEST_F(CommandContainerTest, givenCmdBufferInAllocsListStillUsedByGpuWhenCmdContainerIsInitializedThenNewCmdBufferIsAllocated) {
+    AllocationsList allocList;
+    auto cmdContainer = std::make_unique<CommandContainer>();
+    cmdContainer->initialize(pDevice, &allocList);
+    auto cmdBuffer = cmdContainer->getCmdBufferAllocations()[0];
+
+    auto csr = pDevice->getDefaultEngine().commandStreamReceiver;
+    auto contextId = csr->getOsContext().getContextId();
+    cmdBuffer->updateTaskCount(*csr->getTagAddress() + 1, contextId);
+
+    cmdContainer.reset(new CommandContainer);
+    cmdContainer->initialize(pDevice, &allocList);
+    EXPECT_NE(cmdBuffer, cmdContainer->getCmdBufferAllocations()[0]);
+
+    cmdBuffer->updateTaskCount(*csr->getTagAddress(), contextId);
+    cmdContainer->allocateNextCommandBuffer();
+    EXPECT_EQ(cmdBuffer, cmdContainer->getCmdBufferAllocations()[1]);
+
+    cmdContainer.reset();
+    allocList.freeAllGraphicsAllocations(pDevice);
+}
+
+TEST_F(CommandContainerTest, givenSmallerAndLargerAllocationsInAllocsListWhenDetachingCompletedAllocationThenOnlyAllocationWithinRequiredSizesIsReturned) {
+    AllocationsList allocList;
+    auto memoryManager = pDevice->getMemoryManager();
+    auto smallAllocation = new MockGraphicsAllocation(nullptr, MemoryConstants::pageSize64k / 2);
+    auto largeAllocation = new MockGraphicsAllocation(nullptr, 4 * MemoryConstants::pageSize64k);
+    auto fittingAllocation = new MockGraphicsAllocation(nullptr, MemoryConstants::pageSize64k);
+    smallAllocation->setAllocationType(GraphicsAllocation::AllocationType::LINEAR_STREAM);
+    largeAllocation->setAllocationType(GraphicsAllocation::AllocationType::LINEAR_STREAM);
+    fittingAllocation->setAllocationType(GraphicsAllocation::AllocationType::LINEAR_STREAM);
+    allocList.pushFrontOne(*fittingAllocation);
+    allocList.pushFrontOne(*largeAllocation);
+    allocList.pushFrontOne(*smallAllocation);
+
+    auto allocation = allocList.detachCompletedAllocation(MemoryConstants::pageSize64k, 2 * MemoryConstants::pageSize64k - 1, *memoryManager, GraphicsAllocation::AllocationType::LINEAR_STREAM);
+    EXPECT_EQ(fittingAllocation, allocation.get());
+
+    allocation = allocList.detachCompletedAllocation(MemoryConstants::pageSize64k, 2 * MemoryConstants::pageSize64k - 1, *memoryManager, GraphicsAllocation::AllocationType::LINEAR_STREAM);
+    EXPECT_EQ(nullptr, allocation.get());
+}
+
 TEST_F(CommandContainerTest, givenCommandContainerDuringInitWhenAllocateHeapMemoryFailsThenErrorIsReturned) {
     CommandContainer cmdContainer;
     auto temp_memoryManager = pDevice->executionEnvironment->memoryManager.release();
@@ -259,7 +325,7 @@ TEST_F(CommandContainerTest, givenCommandContainerWhenWantToAddNullPtrToResidenc
     EXPECT_EQ(cmdContainer.getResidencyContainer().size(), size);
 }
 
-TEST_F(CommandContainerTest, givenCommandContainerWhenWantToAddAlreadyAddedAllocationAndDuplicatesRemovedThenExpectedSizeIsReturned) {
+TEST_F(CommandContainerTest, givenCommandContainerWhenWantToAddAlreadyAddedAllocationThenItIsNotAddedAgain) {
     CommandContainer cmdContainer;
     cmdContainer.initialize(pDevice, nullptr);
     MockGraphicsAllocation mockAllocation;
@@ -269,17 +335,61 @@ TEST_F(CommandContainerTest, givenCommandContainerWhenWantToAddAlreadyAddedAlloc
     cmdContainer.addToResidencyContainer(&mockAllocation);
     auto sizeAfterFirstAdd = cmdContainer.getResidencyContainer().size();
 
-    EXPECT_NE(sizeBefore, sizeAfterFirstAdd);
+    EXPECT_EQ(sizeBefore + 1, sizeAfterFirstAdd);
 
-    cmdContainer.addToResidencyContainer(&mockAllocation);
-    auto sizeAfterSecondAdd = cmdContainer.getResidencyContainer().size();
+    for (uint32_t i = 0; i < 100; i++) {
+        cmdContainer.addToResidencyContainer(&mockAllocation);
+    }
+    EXPECT_EQ(sizeAfterFirstAdd, cmdContainer.getResidencyContainer().size());
+
+    cmdContainer.removeDuplicatesFromResidencyContainer();
+    EXPECT_EQ(sizeAfterFirstAdd, cmdContainer.getResidencyContainer().size());
+}
+
+TEST_F(CommandContainerTest, givenAllocationPushedDirectlyToResidencyContainerWhenDuplicatesRemovedThenFirstOccurrencesAreKeptInOrder) {
+    CommandContainer cmdContainer;
+    cmdContainer.initialize(pDevice, nullptr);
+    MockGraphicsAllocation mockAllocation0;
+    MockGraphicsAllocation mockAllocation1;
+
+    auto sizeBefore = cmdContainer.getResidencyContainer().size();
 
-    EXPECT_NE(sizeAfterFirstAdd, sizeAfterSecondAdd);
+    cmdContainer.addToResidencyContainer(&mockAllocation0);
+    cmdContainer.getResidencyContainer().push_back(&mockAllocation0);
+    cmdContainer.getResidencyContainer().push_back(&mockAllocation1);
+    cmdContainer.getResidencyContainer().push_back(&mockAllocation1);
 
     cmdContainer.removeDuplicatesFromResidencyContainer();
-    auto sizeAfterDuplicatesRemoved = cmdContainer.getResidencyContainer().size();
+    auto &residencyContainer = cmdContainer.getResidencyContainer();
+    ASSERT_EQ(sizeBefore + 2, residencyContainer.size());
+    EXPECT_EQ(&mockAllocation0, residencyContainer[sizeBefore]);
+    EXPECT_EQ(&mockAllocation1, residencyContainer[sizeBefore + 1]);
+
+    cmdContainer.addToResidencyContainer(&mockAllocation1);
+    EXPECT_EQ(sizeBefore + 2, residencyContainer.size());
+}
+
+TEST_F(CommandContainerTest, givenAllocationRemovedFromResidencyContainerWhenAddedAgainThenItIsAdded) {
+    CommandContainer cmdContainer;
+    cmdContainer.initialize(pDevice, nullptr);
+    MockGraphicsAllocation mockAllocation;
 
-    EXPECT_EQ(sizeAfterFirstAdd, sizeAfterDuplicatesRemoved);
+    auto &residencyContainer = cmdContainer.getResidencyContainer();
+    auto sizeBefore = residencyContainer.size();
+
+    cmdContainer.addToResidencyContainer(&mockAllocation);
+    cmdContainer.removeFromResidencyContainer(&mockAllocation);
+    EXPECT_EQ(sizeBefore, residencyContainer.size());
+    EXPECT_EQ(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), &mockAllocation));
+
+    cmdContainer.addToResidencyContainer(&mockAllocation);
+    EXPECT_EQ(sizeBefore + 1, residencyContainer.size());
+
+    cmdContainer.clearResidencyContainer();
+    EXPECT_EQ(0u, residencyContainer.size());
+
+    cmdContainer.addToResidencyContainer(&mockAllocation);
+    EXPECT_EQ(1u, residencyContainer.size());
 }
 
 HWTEST_F(CommandContainerTest, givenCmdContainerWhenInitializeCalledThenSSHHeapHasBindlessOffsetReserved) {
@@ -5,8 +5,10 @@
  *
  */
 
+#include "shared/source/aub_mem_dump/aub_compressed_file_writer.h"
 #include "shared/source/aub_mem_dump/page_table_entry_bits.h"
 #include "shared/source/command_stream/aub_command_stream_receiver_hw.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/hardware_context_controller.h"
 #include "shared/source/helpers/neo_driver_version.h"
 #include "shared/source/os_interface/os_context.h"
@@ -26,8 +28,11 @@
 #include "driver_version.h"
 #include "sys_calls.h"
 
+#include <cstdio>
 #include <fstream>
 #include <memory>
+#include <sstream>
+#include <vector>
 
 using namespace NEO;
 
@@ -993,3 +998,142 @@ HWTEST_F(AubFileStreamTests, givenGenerateAubFilePerProcessIdDebugFlagAndAubComm
     strExtendedFileName << "_1_aubfile_PID_" << SysCalls::getProcessId() << ".aub";
     EXPECT_NE(std::string::npos, fullName.find(strExtendedFileName.str()));
 }
+
+TEST(AubFileStreamSkipUnchangedPagesTests, givenSkipUnchangedPagesEnabledWhenPagesAreWrittenAgainThenOnlyChangedPagesAreWritten) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AubDumpSkipUnchangedPages.set(true);
+
+    std::string fileName = "skip_unchanged_pages.aub";
+    AUBCommandStreamReceiver::AubFileStream aubFile;
+    aubFile.open(fileName.c_str());
+    ASSERT_TRUE(aubFile.isOpen());
+
+    constexpr size_t pagesSize = 2 * MemoryConstants::pageSize;
+    auto pages = reinterpret_cast<uint8_t *>(alignedMalloc(pagesSize, MemoryConstants::pageSize));
+    memset(pages, 0, pagesSize);
+    const uint64_t physAddress = 0x10000;
+    const uint32_t addressSpace = AubMemDump::AddressSpaceValues::TraceNonlocal;
+    const uint32_t hint = AubMemDump::DataTypeHintValues::TraceNotype;
+
+    auto position = aubFile.fileHandle.tellp();
+    aubFile.writeMemory(physAddress, pages, pagesSize, addressSpace, hint);
+    auto fullWriteSize = static_cast<size_t>(aubFile.fileHandle.tellp() - position);
+    EXPECT_LT(pagesSize, fullWriteSize);
+
+    position = aubFile.fileHandle.tellp();
+    aubFile.writeMemory(physAddress, pages, pagesSize, addressSpace, hint);
+    EXPECT_EQ(position, aubFile.fileHandle.tellp());
+
+    aubFile.writeMemory(physAddress, pages, pagesSize, AubMemDump::AddressSpaceValues::TraceLocal, hint);
+    EXPECT_EQ(position + static_cast<std::streamoff>(fullWriteSize), aubFile.fileHandle.tellp());
+
+    pages[MemoryConstants::pageSize] = 1;
+    position = aubFile.fileHandle.tellp();
+    aubFile.writeMemory(physAddress, pages, pagesSize, addressSpace, hint);
+    auto changedPageWriteSize = static_cast<size_t>(aubFile.fileHandle.tellp() - position);
+    EXPECT_LT(MemoryConstants::pageSize, changedPageWriteSize);
+    EXPECT_GT(fullWriteSize, changedPageWriteSize);
+
+    aubFile.writeMemory(physAddress + sizeof(uint32_t), pages, sizeof(uint32_t), addressSpace, hint);
+    position = aubFile.fileHandle.tellp();
+    aubFile.writeMemory(physAddress, pages, pagesSize, addressSpace, hint);
+    EXPECT_EQ(position + static_cast<std::streamoff>(changedPageWriteSize), aubFile.fileHandle.tellp());
+
+    aubFile.writeMemoryWriteHeader(physAddress + MemoryConstants::pageSize, sizeof(uint32_t), addressSpace, hint);
+    aubFile.write(reinterpret_cast<const char *>(pages), sizeof(uint32_t));
+    position = aubFile.fileHandle.tellp();
+    aubFile.writeMemory(physAddress, pages, pagesSize, addressSpace, hint);
+    EXPECT_EQ(position + static_cast<std::streamoff>(changedPageWriteSize), aubFile.fileHandle.tellp());
+
+    aubFile.close();
+    alignedFree(pages);
+    std::remove(fileName.c_str());
+}
+
+HWTEST_F(AubFileStreamTests, givenSkipUnchangedPagesEnabledWhenAllocationsAreResidentAgainWithSameContentThenOnlyGpuWritablePagesAreWrittenAgain) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AubDumpSkipUnchangedPages.set(true);
+
+    std::string fileName = "skip_unchanged_pages_reupload.aub";
+    AUBCommandStreamReceiver::AubFileStream aubFile;
+    aubFile.open(fileName.c_str());
+    ASSERT_TRUE(aubFile.isOpen());
+
+    auto memory = alignedMalloc(2 * MemoryConstants::pageSize, MemoryConstants::pageSize);
+    memset(memory, 0, 2 * MemoryConstants::pageSize);
+    {
+        auto aubExecutionEnvironment = getEnvironment<AUBCommandStreamReceiverHw<FamilyType>>(true, true, true);
+        auto aubCsr = aubExecutionEnvironment->template getCsr<AUBCommandStreamReceiverHw<FamilyType>>();
+        aubCsr->initializeEngine();
+        aubCsr->stream = &aubFile;
+
+        MockGraphicsAllocation commandBuffer(memory, MemoryConstants::pageSize);
+        commandBuffer.setAllocationType(GraphicsAllocation::AllocationType::COMMAND_BUFFER);
+        MockGraphicsAllocation buffer(ptrOffset(memory, MemoryConstants::pageSize), MemoryConstants::pageSize);
+        buffer.setAllocationType(GraphicsAllocation::AllocationType::BUFFER);
+
+        auto residentUploadSize = [&](GraphicsAllocation &allocation) {
+            aubCsr->setAubWritable(true, allocation);
+            ResidencyContainer allocationsForResidency = {&allocation};
+            auto position = aubFile.fileHandle.tellp();
+            aubCsr->processResidency(allocationsForResidency, 0u);
+            return static_cast<size_t>(aubFile.fileHandle.tellp() - position);
+        };
+
+        // GPU does not write command buffers, so an unchanged one is not written again
+        auto commandBufferUploadSize = residentUploadSize(commandBuffer);
+        EXPECT_LT(MemoryConstants::pageSize, commandBufferUploadSize);
+        EXPECT_GE(commandBufferUploadSize - MemoryConstants::pageSize, residentUploadSize(commandBuffer));
+
+        // GPU may have modified the buffer while it was resident, so resetting it to the same content must be written
+        auto bufferUploadSize = residentUploadSize(buffer);
+        EXPECT_LT(MemoryConstants::pageSize, bufferUploadSize);
+        EXPECT_EQ(bufferUploadSize, residentUploadSize(buffer));
+    }
+    aubFile.close();
+    alignedFree(memory);
+    std::remove(fileName.c_str());
+}
+
+TEST(AubFileStreamCompressionTests, givenAubDumpCompressionEnabledWhenFileIsClosedThenExpandedFileMatchesUncompressedAub) {
+    DebugManagerStateRestore stateRestore;
+    std::vector<uint32_t> memory(4096, 0u);
+    memory[7] = 0x1234;
+
+    auto writeAubFile = [&memory](AUBCommandStreamReceiver::AubFileStream &aubFile, const std::string &fileName) {
+        aubFile.open(fileName.c_str());
+        aubFile.init(0u, 0u);
+        aubFile.addComment("compressed capture");
+        aubFile.writeMemory(0x10000, memory.data(), memory.size() * sizeof(uint32_t), AubMemDump::AddressSpaceValues::TraceNonlocal, AubMemDump::DataTypeHintValues::TraceNotype);
+        aubFile.flush();
+        aubFile.close();
+    };
+
+    std::string fileName = "uncompressed.aub";
+    std::string compressedFileName = "compressed.aub";
+    {
+        AUBCommandStreamReceiver::AubFileStream aubFile;
+        writeAubFile(aubFile, fileName);
+    }
+    DebugManager.flags.AubDumpCompression.set(true);
+    {
+        AUBCommandStreamReceiver::AubFileStream aubFile;
+        writeAubFile(aubFile, compressedFileName);
+    }
+
+    std::ifstream uncompressedFile(fileName, std::ios::binary);
+    std::stringstream uncompressed;
+    uncompressed << uncompressedFile.rdbuf();
+
+    std::ifstream compressedFile(compressedFileName, std::ios::binary | std::ios::ate);
+    EXPECT_GT(uncompressed.str().size(), static_cast<size_t>(compressedFile.tellg()));
+    compressedFile.seekg(0);
+    std::stringstream expanded;
+    EXPECT_TRUE(AubMemDump::CompressedAub::expand(compressedFile, expanded));
+    EXPECT_EQ(uncompressed.str(), expanded.str());
+
+    uncompressedFile.close();
+    compressedFile.close();
+    std::remove(fileName.c_str());
+    std::remove(compressedFileName.c_str());
+}
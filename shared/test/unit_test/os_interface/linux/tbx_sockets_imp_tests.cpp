@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/tbx/tbx_proto.h"
+#include "shared/source/tbx/tbx_sockets_imp.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/os_interface/linux/loopback_tbx_server.h"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+struct MockTbxSocketsImp : public TbxSocketsImp {
+    using TbxSocketsImp::batchedMode;
+    using TbxSocketsImp::pendingData;
+    using TbxSocketsImp::TbxSocketsImp;
+};
+
+std::vector<uint8_t> createPattern(size_t size, uint8_t seed) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; i++) {
+        data[i] = static_cast<uint8_t>(i * 7 + seed);
+    }
+    return data;
+}
+} // namespace
+
+TEST(TbxSocketsImpTest, givenLoopbackTbxServerWhenWritingAndReadingThenServerObservesWrittenData) {
+    LoopbackTbxServer server;
+    ASSERT_TRUE(server.start());
+
+    std::stringstream errors;
+    MockTbxSocketsImp tbxSockets(errors);
+    ASSERT_TRUE(tbxSockets.init("127.0.0.1", server.getPort()));
+    EXPECT_FALSE(tbxSockets.batchedMode);
+
+    auto data = createPattern(64, 1);
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1000, data.data(), data.size(), 0));
+    EXPECT_TRUE(tbxSockets.writeGTT(0x80, 0x1234567800000003));
+    EXPECT_TRUE(tbxSockets.writeMMIO(0x2230, 0xabcd));
+    EXPECT_TRUE(tbxSockets.pendingData.empty());
+
+    std::vector<uint8_t> readData(data.size());
+    std::vector<TbxSockets::MemoryRead> reads = {{0x1000, readData.data(), readData.size()}};
+    EXPECT_TRUE(tbxSockets.readMemoryPipelined(reads));
+    EXPECT_EQ(data, readData);
+
+    uint32_t mmioValue = 0;
+    EXPECT_TRUE(tbxSockets.readMMIO(0x2230, &mmioValue));
+    EXPECT_EQ(0xabcdu, mmioValue);
+
+    tbxSockets.close();
+    server.stop();
+
+    EXPECT_EQ(data, server.getMemory(0x1000, data.size()));
+    EXPECT_EQ(0x1234567800000003u, server.getGttEntry(0x80 / sizeof(uint64_t)));
+    EXPECT_EQ(1u, server.getRequestsCount(HAS_CONTROL_REQ_TYPE));
+    EXPECT_TRUE(errors.str().empty());
+}
+
+TEST(TbxSocketsImpTest, givenBatchedModeWhenWritingAndReadingThenServerObservesWrittenDataAndReadsArePipelined) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.TbxBatchedSockets.set(true);
+
+    LoopbackTbxServer server;
+    ASSERT_TRUE(server.start());
+
+    std::stringstream errors;
+    MockTbxSocketsImp tbxSockets(errors);
+    ASSERT_TRUE(tbxSockets.init("127.0.0.1", server.getPort()));
+    EXPECT_TRUE(tbxSockets.batchedMode);
+
+    constexpr size_t pageSize = 4096;
+    auto pagesCount = TbxSocketsImp::maxPipelinedReads + 3;
+    ASSERT_LT(TbxSocketsImp::maxCopiedWriteSize, pagesCount * pageSize);
+
+    auto smallData = createPattern(64, 1);
+    auto largeData = createPattern(pagesCount * pageSize, 2);
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1000, smallData.data(), smallData.size(), 0));
+    EXPECT_TRUE(tbxSockets.writeMemory(0x100000, largeData.data(), largeData.size(), 0));
+    EXPECT_TRUE(tbxSockets.pendingData.empty());
+    EXPECT_TRUE(tbxSockets.writeGTT(0x80, 0x1234567800000003));
+
+    std::vector<uint8_t> readData(smallData.size());
+    EXPECT_TRUE(tbxSockets.readMemory(0x1000, readData.data(), readData.size()));
+    EXPECT_EQ(smallData, readData);
+
+    std::vector<uint8_t> readPages(pagesCount * pageSize);
+    std::vector<TbxSockets::MemoryRead> reads;
+    for (size_t i = 0; i < pagesCount; i++) {
+        reads.push_back({0x100000 + i * pageSize, readPages.data() + i * pageSize, pageSize});
+    }
+    EXPECT_TRUE(tbxSockets.readMemoryPipelined(reads));
+    EXPECT_EQ(largeData, readPages);
+
+    tbxSockets.close();
+    server.stop();
+
+    EXPECT_EQ(smallData, server.getMemory(0x1000, smallData.size()));
+    EXPECT_EQ(largeData, server.getMemory(0x100000, largeData.size()));
+    EXPECT_EQ(0x1234567800000003u, server.getGttEntry(0x80 / sizeof(uint64_t)));
+    EXPECT_EQ(1u, server.getRequestsCount(HAS_CONTROL_REQ_TYPE));
+    EXPECT_EQ(2u, server.getRequestsCount(HAS_WRITE_DATA_REQ_TYPE));
+    EXPECT_EQ(1u + pagesCount, server.getRequestsCount(HAS_READ_DATA_REQ_TYPE));
+    EXPECT_TRUE(errors.str().empty());
+}
+
+TEST(TbxSocketsImpTest, givenBatchedModeWhenRequestsWithoutResponseAreIssuedThenTheyAreSentWithNextMmioAccess) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.TbxBatchedSockets.set(true);
+
+    LoopbackTbxServer server;
+    ASSERT_TRUE(server.start());
+
+    MockTbxSocketsImp tbxSockets;
+    ASSERT_TRUE(tbxSockets.init("127.0.0.1", server.getPort()));
+    EXPECT_EQ(sizeof(HAS_HDR) + sizeof(HAS_CONTROL_REQ), tbxSockets.pendingData.size());
+
+    auto data = createPattern(256, 3);
+    EXPECT_TRUE(tbxSockets.writeMemory(0x2000, data.data(), data.size(), 0));
+    EXPECT_TRUE(tbxSockets.writeGTT(0, 0x3));
+    EXPECT_EQ(sizeof(HAS_HDR) * 3 + sizeof(HAS_CONTROL_REQ) + sizeof(HAS_WRITE_DATA_REQ) + data.size() + sizeof(HAS_GTT64_REQ),
+              tbxSockets.pendingData.size());
+
+    EXPECT_TRUE(tbxSockets.writeMMIO(0x2550, 1));
+    EXPECT_TRUE(tbxSockets.pendingData.empty());
+
+    EXPECT_TRUE(tbxSockets.writeMemory(0x3000, data.data(), data.size(), 0));
+    EXPECT_FALSE(tbxSockets.pendingData.empty());
+    uint32_t mmioValue = 0;
+    EXPECT_TRUE(tbxSockets.readMMIO(0x2550, &mmioValue));
+    EXPECT_EQ(1u, mmioValue);
+    EXPECT_TRUE(tbxSockets.pendingData.empty());
+
+    EXPECT_TRUE(tbxSockets.writeMemory(0x4000, data.data(), data.size(), 0));
+    tbxSockets.close();
+    server.stop();
+
+    EXPECT_EQ(data, server.getMemory(0x2000, data.size()));
+    EXPECT_EQ(data, server.getMemory(0x3000, data.size()));
+    EXPECT_EQ(data, server.getMemory(0x4000, data.size()));
+}
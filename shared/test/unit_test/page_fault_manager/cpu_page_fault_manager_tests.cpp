@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/unified_memory/unified_memory.h"
@@ -14,6 +15,9 @@
 #include "shared/test/common/test_macros/test_checks_shared.h"
 #include "shared/test/unit_test/page_fault_manager/cpu_page_fault_manager_tests_fixture.h"
 
+#include <atomic>
+#include <thread>
+
 using namespace NEO;
 
 TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocsWhenInsertingAllocsThenAllocsAreTrackedByPageFaultManager) {
@@ -682,3 +686,180 @@ TEST_F(PageFaultManagerTest, givenNoUsmInitialPlacementFlagsWHenInsertingUsmAllo
     pageFaultManager->insertAllocation(allocs[3], 10, unifiedMemoryManager.get(), cmdQ, memoryProperties);
     EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, pageFaultManager->memoryData.at(allocs[3]).domain);
 }
+
+TEST_F(PageFaultManagerTest, givenMigrationGranularitySmallerThanAllocationWhenInsertingAllocationThenChunksAreTracked) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UsmPageFaultMigrationGranularity.set(4);
+
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    pageFaultManager->insertAllocation(alloc, 3 * MemoryConstants::pageSize + 1, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+
+    auto &pageFaultData = pageFaultManager->memoryData[alloc];
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultData.chunkSize);
+    ASSERT_EQ(4u, pageFaultData.chunks.size());
+    for (auto &chunk : pageFaultData.chunks) {
+        EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, chunk.domain);
+        EXPECT_TRUE(chunk.dirty);
+    }
+
+    void *smallAlloc = reinterpret_cast<void *>(0x100000);
+    pageFaultManager->insertAllocation(smallAlloc, MemoryConstants::pageSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+    EXPECT_EQ(0u, pageFaultManager->memoryData[smallAlloc].chunkSize);
+    EXPECT_TRUE(pageFaultManager->memoryData[smallAlloc].chunks.empty());
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocationInGpuDomainWhenVerifyingPageFaultThenOnlyFaultedChunkIsTransferredAndMadeReadable) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UsmPageFaultMigrationGranularity.set(4);
+
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    const size_t size = 4 * MemoryConstants::pageSize;
+    pageFaultManager->insertAllocation(alloc, size, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(1, pageFaultManager->transferRangeToGpuCalled);
+    EXPECT_EQ(0u, pageFaultManager->transferRangeToGpuOffset);
+    EXPECT_EQ(size, pageFaultManager->transferRangeToGpuSize);
+    EXPECT_EQ(0, pageFaultManager->transferToGpuCalled);
+
+    auto faultPtr = ptrOffset(alloc, 2 * MemoryConstants::pageSize + 16);
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(faultPtr));
+
+    EXPECT_EQ(1, pageFaultManager->transferRangeToCpuCalled);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, pageFaultManager->transferRangeToCpuOffset);
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultManager->transferRangeToCpuSize);
+    EXPECT_EQ(0, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(1, pageFaultManager->allowMemoryReadAccessCalled);
+    EXPECT_EQ(ptrOffset(alloc, 2 * MemoryConstants::pageSize), pageFaultManager->allowedMemoryReadAccessAddress);
+    EXPECT_EQ(0, pageFaultManager->allowMemoryAccessCalled);
+
+    auto &chunk = pageFaultManager->memoryData[alloc].chunks[2];
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, chunk.domain);
+    EXPECT_FALSE(chunk.dirty);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(faultPtr));
+    EXPECT_EQ(1, pageFaultManager->transferRangeToCpuCalled);
+    EXPECT_EQ(1, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(ptrOffset(alloc, 2 * MemoryConstants::pageSize), pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultManager->accessAllowedSize);
+    EXPECT_TRUE(chunk.dirty);
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocationWithCleanAndDirtyChunksWhenMovingToGpuDomainThenOnlyDirtyChunksAreTransferred) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UsmPageFaultMigrationGranularity.set(4);
+
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    const size_t size = 4 * MemoryConstants::pageSize;
+    pageFaultManager->insertAllocation(alloc, size, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    pageFaultManager->transferRangeToGpuCalled = 0;
+    pageFaultManager->protectMemoryCalled = 0;
+
+    // chunk 0 is only read, chunk 3 is read and written
+    pageFaultManager->verifyPageFault(alloc);
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, 3 * MemoryConstants::pageSize));
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, 3 * MemoryConstants::pageSize));
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+
+    EXPECT_EQ(1, pageFaultManager->transferRangeToGpuCalled);
+    EXPECT_EQ(3 * MemoryConstants::pageSize, pageFaultManager->transferRangeToGpuOffset);
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultManager->transferRangeToGpuSize);
+    EXPECT_EQ(2, pageFaultManager->protectMemoryCalled);
+
+    auto &pageFaultData = pageFaultManager->memoryData[alloc];
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Gpu, pageFaultData.domain);
+    for (auto &chunk : pageFaultData.chunks) {
+        EXPECT_EQ(PageFaultManager::AllocationDomain::Gpu, chunk.domain);
+        EXPECT_FALSE(chunk.dirty);
+    }
+}
+
+TEST_F(PageFaultManagerTest, givenManyAllocationsWhenVerifyingPageFaultsThenOwningAllocationIsResolvedAndGapsAreRejected) {
+    constexpr size_t allocationsCount = 64;
+    constexpr size_t allocationSize = 0x100;
+    constexpr size_t allocationStride = 0x1000;
+
+    for (size_t i = 0; i < allocationsCount; i++) {
+        pageFaultManager->insertAllocation(reinterpret_cast<void *>(allocationStride * (i + 1)), allocationSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+    }
+
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(allocationStride - 1)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(allocationStride * 2 + allocationSize)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(allocationStride * (allocationsCount + 1))));
+    EXPECT_EQ(0, pageFaultManager->allowMemoryAccessCalled);
+
+    for (size_t i = 0; i < allocationsCount; i++) {
+        auto allocPtr = reinterpret_cast<void *>(allocationStride * (i + 1));
+        EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(allocPtr, allocationSize - 1)));
+        EXPECT_EQ(allocPtr, pageFaultManager->allowedMemoryAccessAddress);
+    }
+    EXPECT_EQ(static_cast<int>(allocationsCount), pageFaultManager->allowMemoryAccessCalled);
+}
+
+TEST_F(PageFaultManagerTest, givenManyAllocationsWhenFaultingFromMultipleThreadsThenAllFaultsAreResolved) {
+    constexpr size_t allocationsCount = 256;
+    constexpr size_t allocationSize = 0x100;
+    constexpr size_t threadsCount = 4;
+
+    for (size_t i = 0; i < allocationsCount; i++) {
+        pageFaultManager->insertAllocation(reinterpret_cast<void *>(allocationSize * (i + 1)), allocationSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+    }
+
+    std::atomic<size_t> resolvedFaults{0};
+    std::vector<std::thread> threads;
+    for (size_t threadId = 0; threadId < threadsCount; threadId++) {
+        threads.emplace_back([&, threadId]() {
+            for (size_t i = threadId; i < allocationsCount; i += threadsCount) {
+                if (pageFaultManager->verifyPageFault(reinterpret_cast<void *>(allocationSize * (i + 1) + 1))) {
+                    resolvedFaults++;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(allocationsCount, resolvedFaults.load());
+    EXPECT_EQ(static_cast<int>(allocationsCount), pageFaultManager->allowMemoryAccessCalled);
+}
+
+TEST_F(PageFaultManagerTest, givenAllocationInGpuDomainWhenMovingToCpuDomainThenAllocationIsTransferredAndAccessible) {
+    void *alloc = reinterpret_cast<void *>(0x1000);
+    pageFaultManager->insertAllocation(alloc, 10, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+
+    pageFaultManager->moveAllocationToCpuDomain(alloc);
+    EXPECT_EQ(0, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(0, pageFaultManager->allowMemoryAccessCalled);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    pageFaultManager->moveAllocationToCpuDomain(alloc);
+    EXPECT_EQ(1, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(1, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(alloc, pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, pageFaultManager->memoryData[alloc].domain);
+
+    pageFaultManager->moveAllocationToCpuDomain(reinterpret_cast<void *>(0x2000));
+    EXPECT_EQ(1, pageFaultManager->transferToCpuCalled);
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocationWhenMovingToCpuDomainThenOnlyGpuChunksAreTransferred) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UsmPageFaultMigrationGranularity.set(4);
+
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    pageFaultManager->insertAllocation(alloc, 4 * MemoryConstants::pageSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, MemoryConstants::pageSize));
+    EXPECT_EQ(1, pageFaultManager->transferRangeToCpuCalled);
+
+    pageFaultManager->moveAllocationToCpuDomain(alloc);
+
+    EXPECT_EQ(4, pageFaultManager->transferRangeToCpuCalled);
+    EXPECT_EQ(4, pageFaultManager->allowMemoryReadAccessCalled);
+    for (auto &chunk : pageFaultManager->memoryData[alloc].chunks) {
+        EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, chunk.domain);
+        EXPECT_FALSE(chunk.dirty);
+    }
+}
@@ -32,6 +32,11 @@ class MockPageFaultManager : public PageFaultManager {
         protectedMemoryAccessAddress = ptr;
         protectedSize = size;
     }
+    void allowCPUMemoryReadAccess(void *ptr, size_t size) override {
+        allowMemoryReadAccessCalled++;
+        allowedMemoryReadAccessAddress = ptr;
+        readAccessAllowedSize = size;
+    }
     void transferToCpu(void *ptr, size_t size, void *cmdQ) override {
         transferToCpuCalled++;
         transferToCpuAddress = ptr;
@@ -41,6 +46,16 @@ class MockPageFaultManager : public PageFaultManager {
         transferToGpuCalled++;
         transferToGpuAddress = ptr;
     }
+    void transferRangeToCpu(void *allocPtr, size_t offset, size_t size, void *cmdQ) override {
+        transferRangeToCpuCalled++;
+        transferRangeToCpuOffset = offset;
+        transferRangeToCpuSize = size;
+    }
+    void transferRangeToGpu(void *allocPtr, size_t offset, size_t size, void *cmdQ) override {
+        transferRangeToGpuCalled++;
+        transferRangeToGpuOffset = offset;
+        transferRangeToGpuSize = size;
+    }
     void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {
         isAubWritable = writable;
     }
@@ -64,14 +79,23 @@ class MockPageFaultManager : public PageFaultManager {
     }
 
     int allowMemoryAccessCalled = 0;
+    int allowMemoryReadAccessCalled = 0;
     int protectMemoryCalled = 0;
     int transferToCpuCalled = 0;
     int transferToGpuCalled = 0;
+    int transferRangeToCpuCalled = 0;
+    int transferRangeToGpuCalled = 0;
     void *transferToCpuAddress = nullptr;
     void *transferToGpuAddress = nullptr;
     void *allowedMemoryAccessAddress = nullptr;
     void *protectedMemoryAccessAddress = nullptr;
+    void *allowedMemoryReadAccessAddress = nullptr;
     size_t transferToCpuSize = 0;
+    size_t transferRangeToCpuOffset = 0;
+    size_t transferRangeToCpuSize = 0;
+    size_t transferRangeToGpuOffset = 0;
+    size_t transferRangeToGpuSize = 0;
+    size_t readAccessAllowedSize = 0;
     size_t accessAllowedSize = 0;
     size_t protectedSize = 0;
     bool isAubWritable = true;
@@ -6,7 +6,10 @@
  */
 
 #include "shared/source/command_stream/scratch_space_controller_base.h"
+#include "shared/source/command_stream/scratch_space_manager.h"
+#include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/test/common/fixtures/device_fixture.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
 #include "shared/test/common/test_macros/test.h"
 
@@ -81,4 +84,168 @@ HWTEST_F(ScratchComtrolerTests, givenCommandQueueWhenProgramHeapBindlessCalledTh
     scratchController->programBindlessSurfaceStateForScratch(nullptr, 0, 0, 0, *pDevice->getDefaultEngine().osContext, gsbaStateDirty, frontEndStateDirty, &csr);
 
     EXPECT_TRUE(static_cast<MockScratchSpaceControllerBase *>(scratchController.get())->programBindlessSurfaceStateForScratchCalled);
-}
\ No newline at end of file
+}
+
+HWTEST_F(ScratchComtrolerTests, givenSharedScratchSpaceEnabledWhenControllersRequireSameScratchSizeThenOneAllocationIsShared) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSharedScratchSpace.set(true);
+
+    MockCsrHw2<FamilyType> csr(*pDevice->getExecutionEnvironment(), 0, pDevice->getDeviceBitfield());
+    csr.initializeTagAllocation();
+    csr.setupContext(*pDevice->getDefaultEngine().osContext);
+
+    auto execEnv = pDevice->getExecutionEnvironment();
+    auto firstController = std::make_unique<ScratchSpaceControllerBase>(pDevice->getRootDeviceIndex(), *execEnv, *csr.getInternalAllocationStorage());
+    auto secondController = std::make_unique<ScratchSpaceControllerBase>(pDevice->getRootDeviceIndex(), *execEnv, *csr.getInternalAllocationStorage());
+
+    bool gsbaStateDirty = false;
+    bool frontEndStateDirty = false;
+    firstController->setRequiredScratchSpace(nullptr, 0, 1024, 0, 0, *pDevice->getDefaultEngine().osContext, gsbaStateDirty, frontEndStateDirty);
+    secondController->setRequiredScratchSpace(nullptr, 0, 1024, 0, 0, *pDevice->getDefaultEngine().osContext, gsbaStateDirty, frontEndStateDirty);
+
+    EXPECT_NE(nullptr, firstController->getScratchSpaceAllocation());
+    EXPECT_EQ(firstController->getScratchSpaceAllocation(), secondController->getScratchSpaceAllocation());
+    EXPECT_EQ(1u, execEnv->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->getScratchSpaceManager()->getAllocationsCount());
+}
+
+HWTEST_F(ScratchComtrolerTests, givenSharedScratchSpaceEnabledWhenLargerScratchIsRequiredThenSharedAllocationGrowsGeometricallyAndRetiredOneIsFreedAfterRelease) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSharedScratchSpace.set(true);
+
+    MockCsrHw2<FamilyType> csr(*pDevice->getExecutionEnvironment(), 0, pDevice->getDeviceBitfield());
+    csr.initializeTagAllocation();
+    csr.setupContext(*pDevice->getDefaultEngine().osContext);
+
+    auto execEnv = pDevice->getExecutionEnvironment();
+    auto scratchSpaceManager = execEnv->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->getScratchSpaceManager();
+    auto firstController = std::make_unique<ScratchSpaceControllerBase>(pDevice->getRootDeviceIndex(), *execEnv, *csr.getInternalAllocationStorage());
+    auto secondController = std::make_unique<ScratchSpaceControllerBase>(pDevice->getRootDeviceIndex(), *execEnv, *csr.getInternalAllocationStorage());
+
+    bool gsbaStateDirty = false;
+    bool frontEndStateDirty = false;
+    firstController->setRequiredScratchSpace(nullptr, 0, 1024, 0, 0, *pDevice->getDefaultEngine().osContext, gsbaStateDirty, frontEndStateDirty);
+    secondController->setRequiredScratchSpace(nullptr, 0, 1024 + 512, 0, 0, *pDevice->getDefaultEngine().osContext, gsbaStateDirty, frontEndStateDirty);
+
+    EXPECT_NE(firstController->getScratchSpaceAllocation(), secondController->getScratchSpaceAllocation());
+    EXPECT_EQ(1024u, firstController->getPerThreadScratchSpaceSize());
+    EXPECT_EQ(2048u, secondController->getPerThreadScratchSpaceSize());
+    EXPECT_EQ(2u, scratchSpaceManager->getAllocationsCount());
+
+    firstController.reset();
+    EXPECT_EQ(1u, scratchSpaceManager->getAllocationsCount());
+}
+
+HWTEST_F(ScratchComtrolerTests, givenSharedScratchSpaceAllocationNotHeldByAnyControllerWhenIdleTrimTimePassedThenAllocationIsFreed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SharedScratchSpaceIdleTrimTime.set(0);
+
+    ScratchSpaceManager scratchSpaceManager(*pDevice->getExecutionEnvironment());
+    size_t allocationSize = 0u;
+    auto allocation = scratchSpaceManager.obtainAllocation({pDevice->getRootDeviceIndex(), MemoryConstants::pageSize, GraphicsAllocation::AllocationType::SCRATCH_SURFACE, pDevice->getDeviceBitfield()}, allocationSize);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(MemoryConstants::pageSize, allocationSize);
+
+    scratchSpaceManager.trim();
+    EXPECT_EQ(1u, scratchSpaceManager.getAllocationsCount());
+
+    scratchSpaceManager.releaseAllocation(allocation);
+    EXPECT_EQ(0u, scratchSpaceManager.getAllocationsCount());
+}
+
+HWTEST_F(ScratchComtrolerTests, givenSharedScratchSpaceAllocationNotHeldByAnyControllerWhenIdleTrimTimeDidNotPassThenAllocationIsReused) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SharedScratchSpaceIdleTrimTime.set(100000);
+
+    ScratchSpaceManager scratchSpaceManager(*pDevice->getExecutionEnvironment());
+    size_t allocationSize = 0u;
+    AllocationProperties properties{pDevice->getRootDeviceIndex(), MemoryConstants::pageSize, GraphicsAllocation::AllocationType::SCRATCH_SURFACE, pDevice->getDeviceBitfield()};
+    auto allocation = scratchSpaceManager.obtainAllocation(properties, allocationSize);
+    ASSERT_NE(nullptr, allocation);
+
+    scratchSpaceManager.releaseAllocation(allocation);
+    EXPECT_EQ(1u, scratchSpaceManager.getAllocationsCount());
+
+    EXPECT_EQ(allocation, scratchSpaceManager.obtainAllocation(properties, allocationSize));
+    scratchSpaceManager.releaseAllocation(allocation);
+}
+
+HWTEST_F(ScratchComtrolerTests, givenSharedScratchSpaceWhenControllersRequireDifferentSizesOfOneSurfaceThenBothUsePerThreadSizeOfSurface) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSharedScratchSpace.set(true);
+
+    MockCsrHw2<FamilyType> csr(*pDevice->getExecutionEnvironment(), 0, pDevice->getDeviceBitfield());
+    csr.initializeTagAllocation();
+    csr.setupContext(*pDevice->getDefaultEngine().osContext);
+
+    auto execEnv = pDevice->getExecutionEnvironment();
+    auto firstController = std::make_unique<ScratchSpaceControllerBase>(pDevice->getRootDeviceIndex(), *execEnv, *csr.getInternalAllocationStorage());
+    auto secondController = std::make_unique<ScratchSpaceControllerBase>(pDevice->getRootDeviceIndex(), *execEnv, *csr.getInternalAllocationStorage());
+
+    bool gsbaStateDirty = false;
+    bool frontEndStateDirty = false;
+    firstController->setRequiredScratchSpace(nullptr, 0, 1024, 0, 0, *pDevice->getDefaultEngine().osContext, gsbaStateDirty, frontEndStateDirty);
+    secondController->setRequiredScratchSpace(nullptr, 0, 256, 0, 0, *pDevice->getDefaultEngine().osContext, gsbaStateDirty, frontEndStateDirty);
+
+    EXPECT_TRUE(secondController->usesSharedScratchSpace());
+    EXPECT_EQ(firstController->getScratchSpaceAllocation(), secondController->getScratchSpaceAllocation());
+    EXPECT_EQ(1024u, firstController->getPerThreadScratchSpaceSize());
+    EXPECT_EQ(1024u, secondController->getPerThreadScratchSpaceSize());
+}
+
+HWTEST_F(ScratchComtrolerTests, givenSharedScratchSpaceNotUsedForIdleTrimTimeWhenCsrCleansTemporaryAllocationsThenControllerReleasesSurfaceAndObtainsItAgainWhenRequired) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSharedScratchSpace.set(true);
+    DebugManager.flags.SharedScratchSpaceIdleTrimTime.set(0);
+
+    MockCsrHw2<FamilyType> csr(*pDevice->getExecutionEnvironment(), 0, pDevice->getDeviceBitfield());
+    csr.initializeTagAllocation();
+    csr.setupContext(*pDevice->getDefaultEngine().osContext);
+
+    auto execEnv = pDevice->getExecutionEnvironment();
+    auto scratchSpaceManager = execEnv->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->getScratchSpaceManager();
+    csr.scratchSpaceController = std::make_unique<ScratchSpaceControllerBase>(pDevice->getRootDeviceIndex(), *execEnv, *csr.getInternalAllocationStorage());
+    auto scratchController = csr.getScratchSpaceController();
+
+    bool gsbaStateDirty = false;
+    bool frontEndStateDirty = false;
+    scratchController->setRequiredScratchSpace(nullptr, 0, 1024, 0, 0, *pDevice->getDefaultEngine().osContext, gsbaStateDirty, frontEndStateDirty);
+    EXPECT_NE(nullptr, scratchController->getScratchSpaceAllocation());
+    EXPECT_EQ(1u, scratchSpaceManager->getAllocationsCount());
+
+    csr.waitForTaskCountAndCleanTemporaryAllocationList(0u);
+    EXPECT_EQ(nullptr, scratchController->getScratchSpaceAllocation());
+    EXPECT_EQ(0u, scratchController->getPerThreadScratchSpaceSize());
+    EXPECT_EQ(0u, scratchSpaceManager->getAllocationsCount());
+
+    frontEndStateDirty = false;
+    scratchController->setRequiredScratchSpace(nullptr, 0, 1024, 0, 0, *pDevice->getDefaultEngine().osContext, gsbaStateDirty, frontEndStateDirty);
+    EXPECT_NE(nullptr, scratchController->getScratchSpaceAllocation());
+    EXPECT_TRUE(frontEndStateDirty);
+    EXPECT_EQ(1u, scratchSpaceManager->getAllocationsCount());
+}
+
+HWTEST_F(ScratchComtrolerTests, givenSharedScratchSpaceUsedWithinIdleTrimTimeWhenCsrCleansTemporaryAllocationsThenControllerKeepsSurface) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSharedScratchSpace.set(true);
+    DebugManager.flags.SharedScratchSpaceIdleTrimTime.set(100000);
+
+    MockCsrHw2<FamilyType> csr(*pDevice->getExecutionEnvironment(), 0, pDevice->getDeviceBitfield());
+    csr.initializeTagAllocation();
+    csr.setupContext(*pDevice->getDefaultEngine().osContext);
+
+    auto execEnv = pDevice->getExecutionEnvironment();
+    auto scratchSpaceManager = execEnv->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->getScratchSpaceManager();
+    csr.scratchSpaceController = std::make_unique<ScratchSpaceControllerBase>(pDevice->getRootDeviceIndex(), *execEnv, *csr.getInternalAllocationStorage());
+    auto scratchController = csr.getScratchSpaceController();
+
+    bool gsbaStateDirty = false;
+    bool frontEndStateDirty = false;
+    scratchController->setRequiredScratchSpace(nullptr, 0, 1024, 0, 0, *pDevice->getDefaultEngine().osContext, gsbaStateDirty, frontEndStateDirty);
+    auto allocation = scratchController->getScratchSpaceAllocation();
+    EXPECT_NE(nullptr, allocation);
+
+    csr.waitForTaskCountAndCleanTemporaryAllocationList(0u);
+    EXPECT_EQ(allocation, scratchController->getScratchSpaceAllocation());
+    EXPECT_EQ(1024u, scratchController->getPerThreadScratchSpaceSize());
+    EXPECT_EQ(1u, scratchSpaceManager->getAllocationsCount());
+}
@@ -22,6 +22,10 @@ void PageFaultManager::transferToCpu(void *ptr, size_t size, void *cmdQ) {
 }
 void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
 }
+void PageFaultManager::transferRangeToCpu(void *allocPtr, size_t offset, size_t size, void *cmdQ) {
+}
+void PageFaultManager::transferRangeToGpu(void *allocPtr, size_t offset, size_t size, void *cmdQ) {
+}
 CompilerCacheConfig getDefaultCompilerCacheConfig() { return {}; }
 const char *getAdditionalBuiltinAsString(EBuiltInOps::Type builtin) { return nullptr; }
 } // namespace NEO
@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/binary_log_writer.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+struct DecodedRecord {
+    BinaryLog::RecordHeader header;
+    std::vector<uint8_t> payload;
+};
+
+std::vector<DecodedRecord> readRecords(const std::string &fileName) {
+    std::ifstream file(fileName, std::ios::in | std::ios::binary);
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    std::vector<DecodedRecord> records;
+    EXPECT_LE(sizeof(BinaryLog::fileMagic) + sizeof(BinaryLog::fileVersion), data.size());
+    if (data.size() < sizeof(BinaryLog::fileMagic) + sizeof(BinaryLog::fileVersion)) {
+        return records;
+    }
+    EXPECT_EQ(0, memcmp(data.data(), BinaryLog::fileMagic, sizeof(BinaryLog::fileMagic)));
+
+    size_t offset = sizeof(BinaryLog::fileMagic) + sizeof(BinaryLog::fileVersion);
+    while (offset + sizeof(BinaryLog::RecordHeader) <= data.size()) {
+        DecodedRecord record;
+        memcpy(&record.header, data.data() + offset, sizeof(BinaryLog::RecordHeader));
+        offset += sizeof(BinaryLog::RecordHeader);
+        record.payload.assign(data.begin() + offset, data.begin() + offset + record.header.payloadSize);
+        offset += record.header.payloadSize;
+        records.push_back(record);
+    }
+    EXPECT_EQ(data.size(), offset);
+    return records;
+}
+} // namespace
+
+TEST(BinaryLogWriterTest, givenApiCallsAndTextLoggedWhenWriterIsDestroyedThenAllRecordsAreWrittenToFile) {
+    std::string fileName("binary_log_writer_test.blog");
+    {
+        BinaryLogWriter writer(fileName, BinaryLogWriter::defaultThreadBufferSize, std::chrono::milliseconds(BinaryLogWriter::defaultFlushIntervalMs));
+        EXPECT_TRUE(writer.isOpen());
+        writer.logApiCall("clFunction", true, 0);
+        writer.logApiCall("clFunction", false, -5);
+        writer.logText("text", 4u);
+        EXPECT_EQ(0u, writer.getDroppedRecordsCount());
+    }
+
+    auto records = readRecords(fileName);
+    std::remove(fileName.c_str());
+
+    ASSERT_EQ(5u, records.size());
+    EXPECT_EQ(static_cast<uint16_t>(BinaryLog::RecordType::ThreadStart), records[0].header.type);
+
+    EXPECT_EQ(static_cast<uint16_t>(BinaryLog::RecordType::String), records[1].header.type);
+    uint32_t stringId = 0u;
+    memcpy(&stringId, records[1].payload.data(), sizeof(stringId));
+    EXPECT_EQ("clFunction", std::string(records[1].payload.begin() + sizeof(stringId), records[1].payload.end()));
+
+    EXPECT_EQ(static_cast<uint16_t>(BinaryLog::RecordType::ApiEnter), records[2].header.type);
+    ASSERT_EQ(sizeof(uint32_t), records[2].payload.size());
+    EXPECT_EQ(0, memcmp(&stringId, records[2].payload.data(), sizeof(stringId)));
+
+    EXPECT_EQ(static_cast<uint16_t>(BinaryLog::RecordType::ApiLeave), records[3].header.type);
+    ASSERT_EQ(sizeof(uint32_t) + sizeof(int32_t), records[3].payload.size());
+    int32_t errorCode = 0;
+    memcpy(&errorCode, records[3].payload.data() + sizeof(stringId), sizeof(errorCode));
+    EXPECT_EQ(-5, errorCode);
+    EXPECT_LE(records[2].header.timestamp, records[3].header.timestamp);
+
+    EXPECT_EQ(static_cast<uint16_t>(BinaryLog::RecordType::Text), records[4].header.type);
+    EXPECT_EQ("text", std::string(records[4].payload.begin(), records[4].payload.end()));
+
+    for (auto &record : records) {
+        EXPECT_EQ(records[0].header.threadIndex, record.header.threadIndex);
+    }
+}
+
+TEST(BinaryLogWriterTest, givenThreadBufferTooSmallWhenLoggingThenRecordsAreDroppedAndReported) {
+    std::string fileName("binary_log_writer_drop_test.blog");
+    constexpr size_t threadBufferSize = 4 * sizeof(BinaryLog::RecordHeader);
+    uint64_t droppedRecords = 0u;
+    {
+        BinaryLogWriter writer(fileName, threadBufferSize, std::chrono::milliseconds(1000000));
+        for (uint32_t i = 0; i < 10; i++) {
+            writer.logApiCall("clFunction", true, 0);
+        }
+        droppedRecords = writer.getDroppedRecordsCount();
+        EXPECT_NE(0u, droppedRecords);
+    }
+
+    auto records = readRecords(fileName);
+    std::remove(fileName.c_str());
+
+    ASSERT_FALSE(records.empty());
+    auto &lastRecord = records.back();
+    EXPECT_EQ(static_cast<uint16_t>(BinaryLog::RecordType::Dropped), lastRecord.header.type);
+    uint64_t reportedDroppedRecords = 0u;
+    ASSERT_EQ(sizeof(reportedDroppedRecords), lastRecord.payload.size());
+    memcpy(&reportedDroppedRecords, lastRecord.payload.data(), sizeof(reportedDroppedRecords));
+    EXPECT_EQ(droppedRecords, reportedDroppedRecords);
+}
+
+TEST(BinaryLogWriterTest, givenFunctionNameNotFittingIntoThreadBufferWhenLoggingThenApiRecordIsDroppedWithoutReferringToMissingString) {
+    std::string fileName("binary_log_writer_string_drop_test.blog");
+    constexpr size_t threadBufferSize = 8 * sizeof(BinaryLog::RecordHeader);
+    std::string function(200, 'f');
+    {
+        BinaryLogWriter writer(fileName, threadBufferSize, std::chrono::milliseconds(1000000));
+        writer.logApiCall(function.c_str(), true, 0);
+        EXPECT_EQ(2u, writer.getDroppedRecordsCount());
+    }
+
+    auto records = readRecords(fileName);
+    std::remove(fileName.c_str());
+
+    ASSERT_EQ(2u, records.size());
+    EXPECT_EQ(static_cast<uint16_t>(BinaryLog::RecordType::ThreadStart), records[0].header.type);
+    EXPECT_EQ(static_cast<uint16_t>(BinaryLog::RecordType::Dropped), records[1].header.type);
+    uint64_t reportedDroppedRecords = 0u;
+    ASSERT_EQ(sizeof(reportedDroppedRecords), records[1].payload.size());
+    memcpy(&reportedDroppedRecords, records[1].payload.data(), sizeof(reportedDroppedRecords));
+    EXPECT_EQ(2u, reportedDroppedRecords);
+}
+
+TEST(BinaryLogWriterTest, givenLoggingThreadExitedWhenAnotherThreadLogsThenItsThreadBufferIsReused) {
+    std::string fileName("binary_log_writer_reuse_test.blog");
+    {
+        BinaryLogWriter writer(fileName, BinaryLogWriter::defaultThreadBufferSize, std::chrono::milliseconds(BinaryLogWriter::defaultFlushIntervalMs));
+        for (uint32_t i = 0; i < 2; i++) {
+            std::thread loggingThread([&writer] { writer.logApiCall("clFunction", true, 0); });
+            loggingThread.join();
+        }
+    }
+
+    auto records = readRecords(fileName);
+    std::remove(fileName.c_str());
+
+    ASSERT_EQ(5u, records.size());
+    EXPECT_EQ(static_cast<uint16_t>(BinaryLog::RecordType::ThreadStart), records[0].header.type);
+    EXPECT_EQ(static_cast<uint16_t>(BinaryLog::RecordType::String), records[1].header.type);
+    EXPECT_EQ(static_cast<uint16_t>(BinaryLog::RecordType::ApiEnter), records[2].header.type);
+    EXPECT_EQ(static_cast<uint16_t>(BinaryLog::RecordType::ThreadStart), records[3].header.type);
+    EXPECT_EQ(static_cast<uint16_t>(BinaryLog::RecordType::ApiEnter), records[4].header.type);
+    EXPECT_EQ(records[2].payload, records[4].payload);
+
+    for (auto &record : records) {
+        EXPECT_EQ(records[0].header.threadIndex, record.header.threadIndex);
+    }
+}
+
+TEST(BinaryLogWriterTest, givenWriterShutDownWhenLoggingThenRecordsAreWrittenWhenWriterIsDestroyed) {
+    std::string fileName("binary_log_writer_shutdown_test.blog");
+    {
+        BinaryLogWriter writer(fileName, BinaryLogWriter::defaultThreadBufferSize, std::chrono::milliseconds(BinaryLogWriter::defaultFlushIntervalMs));
+        BinaryLogWriter::shutdownAll();
+        writer.logText("text", 4u);
+    }
+
+    auto records = readRecords(fileName);
+    std::remove(fileName.c_str());
+
+    ASSERT_EQ(2u, records.size());
+    EXPECT_EQ(static_cast<uint16_t>(BinaryLog::RecordType::ThreadStart), records[0].header.type);
+    EXPECT_EQ(static_cast<uint16_t>(BinaryLog::RecordType::Text), records[1].header.type);
+    EXPECT_EQ("text", std::string(records[1].payload.begin(), records[1].payload.end()));
+}
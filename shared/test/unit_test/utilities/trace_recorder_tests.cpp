@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/trace_recorder.h"
+#include "shared/test/common/mocks/mock_ostime.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+std::string readFile(const std::string &fileName) {
+    std::ifstream file(fileName);
+    return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+struct MockTraceRecorder : public TraceRecorder {
+    using TraceRecorder::TraceRecorder;
+    using TraceRecorder::waitForPendingEvents;
+};
+
+size_t countOccurrences(const std::string &str, const std::string &pattern) {
+    size_t count = 0u;
+    for (auto position = str.find(pattern); position != std::string::npos; position = str.find(pattern, position + 1)) {
+        count++;
+    }
+    return count;
+}
+} // namespace
+
+TEST(TraceRecorderTest, givenTraceRecorderDisabledByDefaultWhenTraceScopeIsUsedThenNothingIsRecorded) {
+    EXPECT_EQ(nullptr, TraceRecorder::get());
+    TraceScope traceScope("api", "clFunction");
+}
+
+TEST(TraceRecorderTest, givenRecordedIntervalsWhenRecorderIsDestroyedThenCompleteChromeTraceIsWritten) {
+    std::string fileName("trace_recorder_test.json");
+    {
+        TraceRecorder traceRecorder(fileName, TraceRecorder::defaultMaxBufferedEvents, std::make_unique<MockOSTime>());
+        EXPECT_TRUE(traceRecorder.isOpen());
+
+        auto start = traceRecorder.getCpuTimestamp();
+        auto end = traceRecorder.getCpuTimestamp();
+        EXPECT_LT(start, end);
+
+        traceRecorder.recordHostInterval("api", "clFunction", 1500u, 4000u);
+        traceRecorder.recordGpuInterval("KERNEL \"name\"", 3u, 2000u, 3000u);
+
+        EXPECT_EQ(std::string::npos, readFile(fileName).find("clFunction"));
+    }
+
+    auto trace = readFile(fileName);
+    std::remove(fileName.c_str());
+
+    EXPECT_EQ(0u, trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"clFunction\",\"cat\":\"api\",\"ph\":\"X\",\"ts\":1.500,\"dur\":2.500,\"pid\":1,\"tid\":"));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"KERNEL \\\"name\\\"\",\"cat\":\"gpu\",\"ph\":\"X\",\"ts\":2.000,\"dur\":1.000,\"pid\":2,\"tid\":3}"));
+    EXPECT_EQ(trace.size() - 4, trace.rfind("\n]}\n"));
+    EXPECT_EQ(std::string::npos, trace.find(",\n\n]}"));
+}
+
+TEST(TraceRecorderTest, givenBufferedEventsLimitReachedWhenRecordingThenWriterThreadStreamsEventsToFile) {
+    std::string fileName("trace_recorder_streaming_test.json");
+    {
+        MockTraceRecorder traceRecorder(fileName, 2u, std::make_unique<MockOSTime>());
+
+        traceRecorder.recordHostInterval("submission", "flushTask", 0u, 1u);
+        traceRecorder.waitForPendingEvents();
+        EXPECT_EQ(0u, countOccurrences(readFile(fileName), "flushTask"));
+
+        traceRecorder.recordHostInterval("submission", "flushTask", 1u, 2u);
+        traceRecorder.waitForPendingEvents();
+        EXPECT_EQ(2u, countOccurrences(readFile(fileName), "flushTask"));
+
+        traceRecorder.recordHostInterval("wait", "waitForTaskCount", 2u, 3u);
+    }
+
+    auto trace = readFile(fileName);
+    std::remove(fileName.c_str());
+
+    EXPECT_EQ(2u, countOccurrences(trace, "flushTask"));
+    EXPECT_EQ(1u, countOccurrences(trace, "waitForTaskCount"));
+}
+
+TEST(TraceRecorderTest, givenManyThreadsRecordingWhenBuffersAreSwappedThenNoEventIsLost) {
+    std::string fileName("trace_recorder_threads_test.json");
+    constexpr uint32_t threadsCount = 4u;
+    constexpr uint32_t eventsPerThread = 100u;
+    {
+        TraceRecorder traceRecorder(fileName, 8u, std::make_unique<MockOSTime>());
+        std::vector<std::thread> threads;
+        for (uint32_t i = 0; i < threadsCount; i++) {
+            threads.emplace_back([&traceRecorder] {
+                for (uint32_t event = 0; event < eventsPerThread; event++) {
+                    traceRecorder.recordHostInterval("api", "clFunction", event, event + 1);
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+
+    auto trace = readFile(fileName);
+    std::remove(fileName.c_str());
+
+    EXPECT_EQ(threadsCount * eventsPerThread, countOccurrences(trace, "clFunction"));
+    EXPECT_EQ(trace.size() - 4, trace.rfind("\n]}\n"));
+}
+
+TEST(TraceRecorderTest, givenRecorderShutDownWhenRecordingAfterwardsThenTraceStaysCompleteAndRecordingDoesNotBlock) {
+    std::string fileName("trace_recorder_shutdown_test.json");
+    {
+        TraceRecorder traceRecorder(fileName, 1u, std::make_unique<MockOSTime>());
+        traceRecorder.recordHostInterval("api", "clFunction", 0u, 1u);
+        traceRecorder.recordHostInterval("api", "clFunction", 1u, 2u);
+        traceRecorder.shutdown();
+
+        auto trace = readFile(fileName);
+        EXPECT_EQ(2u, countOccurrences(trace, "clFunction"));
+        EXPECT_EQ(trace.size() - 4, trace.rfind("\n]}\n"));
+
+        traceRecorder.recordHostInterval("api", "clLateFunction", 2u, 3u);
+        traceRecorder.flush();
+    }
+
+    auto trace = readFile(fileName);
+    std::remove(fileName.c_str());
+
+    EXPECT_EQ(0u, countOccurrences(trace, "clLateFunction"));
+    EXPECT_EQ(1u, countOccurrences(trace, "\n]}\n"));
+}